@@ -1,4 +1,5 @@
 #include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/JobTimer.h>
 #include <UnAsync/SyncWait.h>
 #include <UnAsync/Task.h>
 #include <UnAsync/WhenAll.h>
@@ -43,11 +44,11 @@ Task<> Test1(const std::stop_token& cancellationToken)
     }
 }
 
-void CancellingTask(std::stop_source& source)
+Task<> CancellingTask(std::stop_source& source)
 {
     std::cout << "Cancelling task\n" << std::flush;
     using namespace std::chrono_literals;
-    std::this_thread::sleep_for(5s);
+    co_await Delay(pScheduler.Get(), 5s);
     source.request_stop();
 }
 
@@ -58,15 +59,11 @@ Task<> TestAwait()
     std::stop_source cancellationSource;
     auto cancellationToken = cancellationSource.get_token();
 
-    Job::RunOneTime(pScheduler.Get(), [&cancellationSource]() {
-        CancellingTask(cancellationSource);
-    });
-
     auto f = [cancellationToken] {
         return Test1(cancellationToken);
     };
 
-    co_await WhenAllReady(f(), f());
+    co_await WhenAllReady(CancellingTask(cancellationSource), f(), f());
 }
 
 int main()
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/AsyncGenerator.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/Task.h>
+#include <algorithm>
+#include <cstdint>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    //! \return An address close to the top of the calling thread's stack.
+    [[gnu::noinline]] std::uintptr_t GetStackAddress()
+    {
+        volatile char marker = 0;
+        return reinterpret_cast<std::uintptr_t>(&marker);
+    }
+
+    AsyncGenerator<USize> Range(USize count)
+    {
+        for (USize i = 0; i < count; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    Task<USize> Sum(USize count, std::uintptr_t& deepestStackAddress)
+    {
+        USize sum      = 0;
+        auto generator = Range(count);
+        for (auto it = co_await generator.begin(); it != generator.end(); co_await ++it)
+        {
+            sum += *it;
+        }
+
+        deepestStackAddress = GetStackAddress();
+        co_return sum;
+    }
+
+    //! \brief Consume a long stream of values, the producer and the consumer resume each other for every value.
+    void AsyncGeneratorIterate(benchmark::State& state)
+    {
+        const auto count = static_cast<USize>(state.range(0));
+
+        std::uintptr_t deepestStackAddress = 0;
+        std::ptrdiff_t stackGrowth         = 0;
+        for (auto _ : state)
+        {
+            auto stackAddress = GetStackAddress();
+            benchmark::DoNotOptimize(SyncWait(Sum(count, deepestStackAddress)));
+            stackGrowth = std::max(stackGrowth, static_cast<std::ptrdiff_t>(stackAddress - deepestStackAddress));
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(count));
+        state.counters["StackBytes"] = static_cast<double>(stackGrowth);
+    }
+} // namespace
+
+BENCHMARK(AsyncGeneratorIterate)->Arg(1'000)->Arg(1'000'000);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Jobs/Job.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    struct InlineJobPolicy final
+    {
+        template<class TFunc>
+        inline static Job* Create(TFunc f, bool isOneTimeSubmit)
+        {
+            return new InlineJob(std::move(f), JobPriority::Normal, isOneTimeSubmit);
+        }
+    };
+
+    struct FunctionJobPolicy final
+    {
+        template<class TFunc>
+        inline static Job* Create(TFunc f, bool isOneTimeSubmit)
+        {
+            return new FunctionJob(std::move(f), JobPriority::Normal, isOneTimeSubmit);
+        }
+    };
+
+    //! \brief Execute many jobs that are spread over memory in random order, like jobs popped from queues.
+    template<class TPolicy>
+    void ExecuteScattered(benchmark::State& state)
+    {
+        const auto jobCount = static_cast<USize>(state.range(0));
+
+        UInt64 counter = 0;
+        std::vector<Job*> jobs;
+        for (USize i = 0; i < jobCount; ++i)
+        {
+            jobs.push_back(TPolicy::Create(
+                [&counter, i]() {
+                    counter += i;
+                },
+                false));
+        }
+
+        std::shuffle(jobs.begin(), jobs.end(), std::mt19937_64{ 42 });
+
+        JobExecutionContext context{ 0 };
+        for (auto _ : state)
+        {
+            for (auto* pJob : jobs)
+            {
+                pJob->ExecuteInternal(context);
+            }
+        }
+
+        benchmark::DoNotOptimize(counter);
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(jobCount));
+
+        for (auto* pJob : jobs)
+        {
+            delete pJob;
+        }
+    }
+
+    //! \brief Allocate, execute and delete a one-time job, like Job::RunOneTime() does without the scheduler.
+    template<class TPolicy>
+    void CreateExecuteDelete(benchmark::State& state)
+    {
+        UInt64 counter = 0;
+        JobExecutionContext context{ 0 };
+        for (auto _ : state)
+        {
+            auto* pJob = TPolicy::Create(
+                [&counter]() {
+                    ++counter;
+                },
+                true);
+            pJob->ExecuteInternal(context);
+        }
+
+        benchmark::DoNotOptimize(counter);
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK(ExecuteScattered<InlineJobPolicy>)->RangeMultiplier(16)->Range(256, 64 * 1024);
+BENCHMARK(ExecuteScattered<FunctionJobPolicy>)->RangeMultiplier(16)->Range(256, 64 * 1024);
+BENCHMARK(CreateExecuteDelete<InlineJobPolicy>);
+BENCHMARK(CreateExecuteDelete<FunctionJobPolicy>);
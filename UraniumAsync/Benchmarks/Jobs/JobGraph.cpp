@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/JobGraph.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    constexpr USize LayerCount = 16;
+
+    //! \brief Index of a node in a graph of layers where node i depends on nodes i and i + 1 of the previous layer.
+    inline USize GetNodeIndex(USize layer, USize i, USize layerWidth)
+    {
+        return layer * layerWidth + i;
+    }
+
+    void CompiledJobGraph(benchmark::State& state)
+    {
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+        const auto layerWidth               = static_cast<USize>(state.range(0));
+
+        std::atomic<UInt64> counter = 0;
+        JobGraph graph;
+        for (USize i = 0; i < LayerCount * layerWidth; ++i)
+        {
+            graph.AddNode([&counter] {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+
+        for (USize layer = 1; layer < LayerCount; ++layer)
+        {
+            for (USize i = 0; i < layerWidth; ++i)
+            {
+                auto to = static_cast<JobGraph::NodeID>(GetNodeIndex(layer, i, layerWidth));
+                graph.AddEdge(static_cast<JobGraph::NodeID>(GetNodeIndex(layer - 1, i, layerWidth)), to);
+                graph.AddEdge(static_cast<JobGraph::NodeID>(GetNodeIndex(layer - 1, (i + 1) % layerWidth, layerWidth)), to);
+            }
+        }
+
+        graph.Compile();
+
+        for (auto _ : state)
+        {
+            SyncWait(graph.RunAsync(pScheduler.Get()));
+        }
+
+        benchmark::DoNotOptimize(counter.load());
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(LayerCount * layerWidth));
+    }
+
+    //! \brief The baseline: build the same graph of one-time jobs with AttachParent() on every run.
+    void RebuiltJobGraph(benchmark::State& state)
+    {
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+        const auto layerWidth               = static_cast<USize>(state.range(0));
+
+        std::atomic<UInt64> counter = 0;
+        std::vector<Job*> jobs(LayerCount * layerWidth);
+        for (auto _ : state)
+        {
+            Internal::ManualResetEvent event;
+            Job* pSink = new FunctionJob(
+                [&event] {
+                    event.Set();
+                },
+                JobPriority::Normal, true);
+
+            for (auto& pJob : jobs)
+            {
+                pJob = new FunctionJob(
+                    [&counter] {
+                        counter.fetch_add(1, std::memory_order_relaxed);
+                    },
+                    JobPriority::Normal, true);
+            }
+
+            for (USize layer = 1; layer < LayerCount; ++layer)
+            {
+                for (USize i = 0; i < layerWidth; ++i)
+                {
+                    auto* pJob = jobs[GetNodeIndex(layer, i, layerWidth)];
+                    pJob->AttachParent(jobs[GetNodeIndex(layer - 1, i, layerWidth)]);
+                    pJob->AttachParent(jobs[GetNodeIndex(layer - 1, (i + 1) % layerWidth, layerWidth)]);
+                }
+            }
+
+            for (USize i = 0; i < layerWidth; ++i)
+            {
+                pSink->AttachParent(jobs[GetNodeIndex(LayerCount - 1, i, layerWidth)]);
+            }
+
+            // Schedule the sink and the deeper layers first, so that no job completes before its successors are scheduled
+            pSink->Schedule(pScheduler.Get());
+            for (auto iter = jobs.rbegin(); iter != jobs.rend(); ++iter)
+            {
+                (*iter)->Schedule(pScheduler.Get());
+            }
+
+            event.Wait();
+        }
+
+        benchmark::DoNotOptimize(counter.load());
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(LayerCount * layerWidth));
+    }
+} // namespace
+
+BENCHMARK(CompiledJobGraph)->Arg(4)->Arg(64)->UseRealTime();
+BENCHMARK(RebuiltJobGraph)->Arg(4)->Arg(64)->UseRealTime();
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/ParallelAlgorithms.h>
+#include <UnAsync/SyncWait.h>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    std::vector<UInt32> MakeRandomValues(USize count)
+    {
+        std::mt19937 random(42);
+        std::vector<UInt32> result(count);
+        for (auto& value : result)
+        {
+            value = random();
+        }
+
+        return result;
+    }
+
+    JobScheduler* GetScheduler()
+    {
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+        return pScheduler.Get();
+    }
+
+    void StdSort(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto data = values;
+            state.ResumeTiming();
+
+            std::sort(data.begin(), data.end());
+            benchmark::DoNotOptimize(data.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void ParallelSortRandom(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto data = values;
+            state.ResumeTiming();
+
+            SyncWait(ParallelSort(GetScheduler(), data.begin(), data.end()));
+            benchmark::DoNotOptimize(data.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void StdAccumulate(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(std::accumulate(values.begin(), values.end(), UInt64{ 0 }));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void ParallelReduceSum(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(SyncWait(ParallelReduce(
+                GetScheduler(), USize{ 0 }, values.size(), UInt64{ 0 },
+                [&values](USize i) {
+                    return static_cast<UInt64>(values[i]);
+                },
+                std::plus<>{})));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void StdInclusiveScan(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        std::vector<UInt32> result(values.size());
+        for (auto _ : state)
+        {
+            std::inclusive_scan(values.begin(), values.end(), result.begin());
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void ParallelInclusiveScanSum(benchmark::State& state)
+    {
+        const auto values = MakeRandomValues(static_cast<USize>(state.range(0)));
+        std::vector<UInt32> result(values.size());
+        for (auto _ : state)
+        {
+            SyncWait(ParallelInclusiveScan(GetScheduler(), values.begin(), values.end(), result.begin()));
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(StdSort)->Arg(1 << 16)->Arg(1 << 22)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(ParallelSortRandom)->Arg(1 << 16)->Arg(1 << 22)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(StdAccumulate)->Arg(1 << 22)->UseRealTime();
+BENCHMARK(ParallelReduceSum)->Arg(1 << 22)->UseRealTime();
+BENCHMARK(StdInclusiveScan)->Arg(1 << 22)->UseRealTime();
+BENCHMARK(ParallelInclusiveScanSum)->Arg(1 << 22)->UseRealTime();
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/ParallelFor.h>
+#include <cmath>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    constexpr int ItemCount = 100'000;
+
+    //! \brief The same small amount of work for every index.
+    struct RegularWorkload final
+    {
+        inline static double Run(int index)
+        {
+            return std::sqrt(static_cast<double>(index));
+        }
+    };
+
+    //! \brief Every 64th index is two orders of magnitude more expensive than the rest,
+    //! and the expensive indices are clustered at the end of the range.
+    struct IrregularWorkload final
+    {
+        inline static double Run(int index)
+        {
+            auto iterations = (index % 64 == 0 && index > ItemCount / 2) ? 200 : 1;
+            double result   = 0;
+            for (int i = 0; i < iterations; ++i)
+            {
+                result += std::sqrt(static_cast<double>(index + i));
+            }
+
+            return result;
+        }
+    };
+
+    template<class TWorkload>
+    void ParallelForPartitioners(benchmark::State& state)
+    {
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+
+        ParallelForDesc desc;
+        desc.Partitioner = static_cast<ParallelForPartitioner>(state.range(0));
+        desc.GrainSize   = static_cast<USize>(state.range(1));
+
+        std::atomic<double> sink = 0;
+        for (auto _ : state)
+        {
+            ParallelFor(
+                pScheduler.Get(), 0, ItemCount,
+                [&sink](int begin, int end) {
+                    double result = 0;
+                    for (int i = begin; i < end; ++i)
+                    {
+                        result += TWorkload::Run(i);
+                    }
+
+                    sink.store(result, std::memory_order_relaxed);
+                },
+                desc);
+        }
+
+        state.SetItemsProcessed(state.iterations() * ItemCount);
+    }
+
+    //! \brief The hand-rolled baseline: one one-time job per index.
+    template<class TWorkload>
+    void JobPerItem(benchmark::State& state)
+    {
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+
+        for (auto _ : state)
+        {
+            std::atomic<int> remaining = ItemCount;
+            Internal::ManualResetEvent event;
+            for (int i = 0; i < ItemCount; ++i)
+            {
+                Job::RunOneTime(pScheduler.Get(), [i, &remaining, &event]() {
+                    benchmark::DoNotOptimize(TWorkload::Run(i));
+                    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        event.Set();
+                    }
+                });
+            }
+
+            event.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * ItemCount);
+    }
+
+    void PartitionerArguments(benchmark::internal::Benchmark* pBenchmark)
+    {
+        pBenchmark->ArgNames({ "partitioner", "grain" });
+        constexpr ParallelForPartitioner partitioners[] = { ParallelForPartitioner::Adaptive, ParallelForPartitioner::Static,
+                                                            ParallelForPartitioner::Simple };
+        for (auto partitioner : partitioners)
+        {
+            for (Int64 grainSize : { 1, 64, 1024 })
+            {
+                pBenchmark->Args({ static_cast<Int64>(partitioner), grainSize });
+            }
+        }
+    }
+} // namespace
+
+BENCHMARK(ParallelForPartitioners<RegularWorkload>)->Apply(PartitionerArguments)->UseRealTime();
+BENCHMARK(ParallelForPartitioners<IrregularWorkload>)->Apply(PartitionerArguments)->UseRealTime();
+BENCHMARK(JobPerItem<RegularWorkload>)->UseRealTime();
+BENCHMARK(JobPerItem<IrregularWorkload>)->UseRealTime();
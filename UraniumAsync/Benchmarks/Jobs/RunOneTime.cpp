@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    //! \brief A one-time job that bypasses the job pool, the way Job::RunOneTime() used to allocate jobs.
+    template<class TFunc>
+    class HeapFunctionJob final : public FunctionJob<TFunc>
+    {
+    public:
+        using FunctionJob<TFunc>::FunctionJob;
+
+        inline static void* operator new(std::size_t size)
+        {
+            return ::operator new(size);
+        }
+
+        inline static void operator delete(void* pointer) noexcept
+        {
+            ::operator delete(pointer);
+        }
+    };
+
+    struct PooledPolicy final
+    {
+        template<class TFunc>
+        inline static void Run(IJobScheduler* pScheduler, TFunc f)
+        {
+            Job::RunOneTime(pScheduler, std::move(f));
+        }
+    };
+
+    struct HeapPolicy final
+    {
+        template<class TFunc>
+        inline static void Run(IJobScheduler* pScheduler, TFunc f)
+        {
+            pScheduler->ScheduleJob(new HeapFunctionJob<TFunc>(std::move(f), JobPriority::Normal, true));
+        }
+    };
+
+    constexpr int BatchSize = 4096;
+
+    //! \brief Submit a batch of one-time jobs from an external thread, the jobs are freed on the workers.
+    template<class TPolicy>
+    void ExternalSubmit(benchmark::State& state)
+    {
+        Ptr pScheduler = AllocateObject<JobScheduler>(static_cast<UInt32>(state.range(0)));
+        for (auto _ : state)
+        {
+            std::atomic<int> counter = 0;
+            Internal::ManualResetEvent event;
+            for (int i = 0; i < BatchSize; ++i)
+            {
+                TPolicy::Run(pScheduler.Get(), [&counter, &event]() {
+                    if (++counter == BatchSize)
+                    {
+                        event.Set();
+                    }
+                });
+            }
+
+            event.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+
+    constexpr int ChainCount = 64;
+
+    template<class TPolicy>
+    struct ChainState final
+    {
+        IJobScheduler* pScheduler;
+        std::atomic<int> Remaining = BatchSize;
+        std::atomic<int> Completed = 0;
+        Internal::ManualResetEvent Event;
+
+        inline void RunNext()
+        {
+            TPolicy::Run(pScheduler, [this]() {
+                if (Remaining.fetch_sub(1, std::memory_order_relaxed) > ChainCount)
+                {
+                    RunNext();
+                }
+
+                if (++Completed == BatchSize)
+                {
+                    Event.Set();
+                }
+            });
+        }
+    };
+
+    //! \brief Every job submits the next one from a worker thread, like Pipe::Schedule() does on flushes.
+    template<class TPolicy>
+    void WorkerSubmit(benchmark::State& state)
+    {
+        auto workerCount = static_cast<UInt32>(state.range(0));
+        Ptr pScheduler   = AllocateObject<JobScheduler>(workerCount);
+        for (auto _ : state)
+        {
+            ChainState<TPolicy> chain;
+            chain.pScheduler = pScheduler.Get();
+            for (int i = 0; i < ChainCount; ++i)
+            {
+                chain.RunNext();
+            }
+
+            chain.Event.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+} // namespace
+
+BENCHMARK(ExternalSubmit<PooledPolicy>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(ExternalSubmit<HeapPolicy>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(WorkerSubmit<PooledPolicy>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(WorkerSubmit<HeapPolicy>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
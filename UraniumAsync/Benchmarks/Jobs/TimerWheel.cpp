@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Jobs/TimerWheel.h>
+#include <random>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    //! \brief Insert and cancel timers while the wheel already holds many of them, like request timeouts.
+    void TimerWheelInsertRemove(benchmark::State& state)
+    {
+        const auto timerCount = static_cast<USize>(state.range(0));
+
+        auto start = JobClock::now();
+        Internal::TimerWheel wheel(start);
+
+        std::mt19937_64 random(42);
+        std::uniform_int_distribution<Int64> distribution(1, 60'000);
+        std::vector<Internal::TimerWheelEntry> entries(timerCount);
+        for (auto& entry : entries)
+        {
+            entry.Deadline = start + std::chrono::milliseconds(distribution(random));
+            wheel.Insert(&entry);
+        }
+
+        USize index = 0;
+        for (auto _ : state)
+        {
+            auto& entry = entries[index];
+            wheel.Remove(&entry);
+            wheel.Insert(&entry);
+            index = index + 1 == timerCount ? 0 : index + 1;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    //! \brief Expire timers spread over a minute, one tick at a time.
+    void TimerWheelAdvance(benchmark::State& state)
+    {
+        const auto timerCount = static_cast<USize>(state.range(0));
+
+        std::mt19937_64 random(42);
+        std::uniform_int_distribution<Int64> distribution(1, 60'000);
+        std::vector<Internal::TimerWheelEntry> entries(timerCount);
+
+        for (auto _ : state)
+        {
+            auto start = JobClock::now();
+            Internal::TimerWheel wheel(start);
+            for (auto& entry : entries)
+            {
+                entry.Deadline = start + std::chrono::milliseconds(distribution(random));
+                wheel.Insert(&entry);
+            }
+
+            USize expiredCount = 0;
+            for (auto now = start; expiredCount < timerCount; now += Internal::TimerWheel::TickDuration)
+            {
+                for (auto* pEntry = wheel.Advance(now); pEntry; pEntry = pEntry->pNext)
+                {
+                    ++expiredCount;
+                }
+            }
+
+            benchmark::DoNotOptimize(expiredCount);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(timerCount));
+    }
+} // namespace
+
+BENCHMARK(TimerWheelInsertRemove)->Arg(1'000)->Arg(100'000);
+BENCHMARK(TimerWheelAdvance)->Arg(1'000)->Arg(100'000);
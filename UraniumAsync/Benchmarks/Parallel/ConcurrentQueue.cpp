@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Parallel/ConcurrentQueue.h>
+#include <deque>
+#include <mutex>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    class MutexQueue final
+    {
+        std::deque<int*> m_Deque;
+        std::mutex m_Mutex;
+
+    public:
+        inline void Enqueue(int* value)
+        {
+            std::unique_lock lk(m_Mutex);
+            m_Deque.push_back(value);
+        }
+
+        inline int* Dequeue()
+        {
+            std::unique_lock lk(m_Mutex);
+            if (m_Deque.empty())
+            {
+                return nullptr;
+            }
+
+            auto* value = m_Deque.front();
+            m_Deque.pop_front();
+            return value;
+        }
+    };
+
+    template<class TQueue>
+    void EnqueueThroughput(benchmark::State& state)
+    {
+        static TQueue* pQueue;
+        static int value;
+
+        if (state.thread_index() == 0)
+        {
+            pQueue = new TQueue;
+        }
+
+        for (auto _ : state)
+        {
+            pQueue->Enqueue(&value);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            delete pQueue;
+        }
+    }
+
+    template<class TQueue>
+    void EnqueueDequeueThroughput(benchmark::State& state)
+    {
+        static TQueue* pQueue;
+        static int value;
+
+        if (state.thread_index() == 0)
+        {
+            pQueue = new TQueue;
+        }
+
+        for (auto _ : state)
+        {
+            pQueue->Enqueue(&value);
+            benchmark::DoNotOptimize(pQueue->Dequeue());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            delete pQueue;
+        }
+    }
+} // namespace
+
+BENCHMARK(EnqueueThroughput<ConcurrentQueue<int*>>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(EnqueueThroughput<MutexQueue>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(EnqueueDequeueThroughput<ConcurrentQueue<int*>>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(EnqueueDequeueThroughput<MutexQueue>)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/Task.h>
+#include <UnAsync/WhenAll.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    //! \return An address close to the top of the calling thread's stack.
+    [[gnu::noinline]] std::uintptr_t GetStackAddress()
+    {
+        volatile char marker = 0;
+        return reinterpret_cast<std::uintptr_t>(&marker);
+    }
+
+    //! \brief A chain of tasks that await each other and all complete synchronously.
+    Task<USize> AwaitChain(USize depth, std::uintptr_t& deepestStackAddress)
+    {
+        if (depth == 0)
+        {
+            deepestStackAddress = GetStackAddress();
+            co_return 0;
+        }
+
+        co_return co_await AwaitChain(depth - 1, deepestStackAddress) + 1;
+    }
+
+    Task<USize> Identity(USize value)
+    {
+        co_return value;
+    }
+
+    //! \brief Create and await many short-lived tasks, each of them allocates and frees a coroutine frame.
+    Task<USize> AwaitMany(USize count)
+    {
+        USize sum = 0;
+        for (USize i = 0; i < count; ++i)
+        {
+            sum += co_await Identity(i);
+        }
+
+        co_return sum;
+    }
+
+    void TaskCreateAndAwait(benchmark::State& state)
+    {
+        const auto count = static_cast<USize>(state.range(0));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(SyncWait(AwaitMany(count)));
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(count));
+    }
+
+    //! \brief Await a deep chain of tasks, the native stack must not grow with the depth of the chain.
+    void TaskAwaitChain(benchmark::State& state)
+    {
+        const auto depth = static_cast<USize>(state.range(0));
+
+        std::uintptr_t deepestStackAddress = 0;
+        std::ptrdiff_t stackGrowth         = 0;
+        for (auto _ : state)
+        {
+            auto stackAddress = GetStackAddress();
+            benchmark::DoNotOptimize(SyncWait(AwaitChain(depth, deepestStackAddress)));
+            stackGrowth = std::max(stackGrowth, static_cast<std::ptrdiff_t>(stackAddress - deepestStackAddress));
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(depth));
+        state.counters["StackBytes"] = static_cast<double>(stackGrowth);
+    }
+
+    Task<UInt64> Spin(UInt64 iterationCount)
+    {
+        UInt64 value = iterationCount;
+        for (UInt64 i = 0; i < iterationCount; ++i)
+        {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+
+        co_return value;
+    }
+
+    //! \brief Await a vector of tasks that compute before their first suspension.
+    //!
+    //! Arg 0 starts them one by one on the awaiting thread, arg 1 starts them in parallel on the scheduler.
+    void WhenAllRange(benchmark::State& state)
+    {
+        constexpr USize TaskCount = 256;
+
+        static Ptr<JobScheduler> pScheduler = AllocateObject<JobScheduler>(0);
+
+        const bool isParallel = state.range(0) != 0;
+
+        for (auto _ : state)
+        {
+            std::vector<Task<UInt64>> tasks;
+            tasks.reserve(TaskCount);
+            for (USize i = 0; i < TaskCount; ++i)
+            {
+                tasks.push_back(Spin(10'000));
+            }
+
+            if (isParallel)
+            {
+                benchmark::DoNotOptimize(SyncWait(WhenAll(pScheduler.Get(), std::move(tasks))));
+            }
+            else
+            {
+                benchmark::DoNotOptimize(SyncWait(WhenAll(std::move(tasks))));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<Int64>(TaskCount));
+    }
+} // namespace
+
+BENCHMARK(TaskAwaitChain)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(TaskCreateAndAwait)->Arg(1'000);
+BENCHMARK(WhenAllRange)->Arg(0)->Arg(1)->UseRealTime();
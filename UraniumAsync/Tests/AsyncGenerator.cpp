@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <UnAsync/AsyncGenerator.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    AsyncGenerator<int> Range(int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    Task<std::vector<int>> Collect(AsyncGenerator<int> generator)
+    {
+        std::vector<int> result;
+        for (auto it = co_await generator.begin(); it != generator.end(); co_await ++it)
+        {
+            result.push_back(*it);
+        }
+
+        co_return result;
+    }
+
+    struct NonCopyable
+    {
+        int Value;
+
+        explicit NonCopyable(int value)
+            : Value(value)
+        {
+        }
+
+        NonCopyable(const NonCopyable&)            = delete;
+        NonCopyable& operator=(const NonCopyable&) = delete;
+    };
+} // namespace
+
+TEST(AsyncGenerator, YieldValues)
+{
+    EXPECT_EQ(SyncWait(Collect(Range(5))), (std::vector{ 0, 1, 2, 3, 4 }));
+    EXPECT_TRUE(SyncWait(Collect(Range(0))).empty());
+}
+
+TEST(AsyncGenerator, ValuesAreNotCopied)
+{
+    const NonCopyable* pYielded = nullptr;
+    auto produce                = [&]() -> AsyncGenerator<NonCopyable> {
+        NonCopyable value(42);
+        pYielded = &value;
+        co_yield value;
+    };
+
+    SyncWait([&]() -> Task<> {
+        auto generator = produce();
+        auto it        = co_await generator.begin();
+        EXPECT_EQ(&*it, pYielded);
+        EXPECT_EQ(it->Value, 42);
+        co_await ++it;
+        EXPECT_EQ(it, generator.end());
+    }());
+}
+
+TEST(AsyncGenerator, AwaitInProducer)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    // The producer continues on workers, the consumer is resumed wherever the producer yields
+    auto produce = [&]() -> AsyncGenerator<int> {
+        for (int i = 0; i < 100; ++i)
+        {
+            co_await Job::Run(pScheduler.Get());
+            co_yield i;
+        }
+    };
+
+    auto values = SyncWait(Collect(produce()));
+    ASSERT_EQ(values.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(values[i], i);
+    }
+}
+
+TEST(AsyncGenerator, Exception)
+{
+    auto produce = []() -> AsyncGenerator<int> {
+        co_yield 1;
+        throw std::runtime_error("AsyncGenerator");
+    };
+
+    EXPECT_THROW(SyncWait(Collect(produce())), std::runtime_error);
+}
+
+TEST(AsyncGenerator, StopEarly)
+{
+    bool isDestroyed = false;
+    struct Guard
+    {
+        bool* pIsDestroyed;
+
+        ~Guard()
+        {
+            *pIsDestroyed = true;
+        }
+    };
+
+    auto produce = [&]() -> AsyncGenerator<int> {
+        Guard guard{ &isDestroyed };
+        for (int i = 0;; ++i)
+        {
+            co_yield i;
+        }
+    };
+
+    SyncWait([&]() -> Task<> {
+        auto generator = produce();
+        for (auto it = co_await generator.begin(); *it < 3; co_await ++it)
+        {
+        }
+
+        EXPECT_FALSE(isDestroyed);
+    }());
+
+    EXPECT_TRUE(isDestroyed);
+}
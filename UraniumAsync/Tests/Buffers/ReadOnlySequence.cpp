@@ -134,7 +134,8 @@ TEST(ReadOnlySequence, Iterate)
         totalBytes += buffer.Length();
     }
 
-    EXPECT_EQ(totalBytes, 50 * 10 - 20);
+    // The first segment starts at 10, the end index is clamped to the length of the last segment
+    EXPECT_EQ(totalBytes, 50 * 10 - 10);
     Destroy(s);
 }
 
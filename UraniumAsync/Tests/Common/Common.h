@@ -1 +1,13 @@
+#pragma once
 #include <gtest/gtest.h>
+#include <UnAsync/Jobs/Job.h>
+
+namespace UN::Async::Tests
+{
+    //! \brief Square a number on a worker of the scheduler.
+    inline Task<int> Square(IJobScheduler* pScheduler, int value)
+    {
+        co_await Job::Run(pScheduler);
+        co_return value * value;
+    }
+} // namespace UN::Async::Tests
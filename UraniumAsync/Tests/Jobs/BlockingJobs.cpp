@@ -0,0 +1,157 @@
+#include <Tests/Common/Common.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace UN::Async::Tests;
+using namespace std::chrono_literals;
+
+namespace
+{
+    inline constexpr UInt32 NoWorker = static_cast<UInt32>(-1);
+
+    Task<> Sleep(IJobScheduler* pScheduler, std::chrono::milliseconds duration)
+    {
+        co_await Job::Run(pScheduler);
+        co_await Job::RunBlocking(pScheduler, [duration] {
+            std::this_thread::sleep_for(duration);
+        });
+    }
+} // namespace
+
+TEST(BlockingJobs, RunBlocking)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto task = [&]() -> Task<std::pair<UInt32, UInt32>> {
+        co_await Job::Run(pScheduler.Get());
+        auto blockingWorkerID = co_await Job::RunBlocking(pScheduler.Get(), [&] {
+            return pScheduler->GetWorkerID();
+        });
+
+        co_return std::make_pair(blockingWorkerID, pScheduler->GetWorkerID());
+    };
+
+    auto [blockingWorkerID, workerID] = SyncWait(task());
+    EXPECT_EQ(blockingWorkerID, NoWorker);
+    EXPECT_NE(workerID, NoWorker);
+    EXPECT_EQ(pScheduler->GetBlockingThreadCount(), 1u);
+}
+
+TEST(BlockingJobs, Exception)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto task = [&]() -> Task<UInt32> {
+        co_await Job::Run(pScheduler.Get());
+        try
+        {
+            co_await Job::RunBlocking(pScheduler.Get(), [] {
+                throw std::runtime_error("Blocking job failed");
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+            co_return pScheduler->GetWorkerID();
+        }
+
+        co_return NoWorker;
+    };
+
+    EXPECT_NE(SyncWait(task()), NoWorker);
+}
+
+TEST(BlockingJobs, WorkersStayResponsive)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // Blocking calls would occupy the only worker if they ran on it
+    std::thread blocking([&] {
+        SyncWait(WhenAll(Sleep(pScheduler.Get(), 300ms), Sleep(pScheduler.Get(), 300ms), Sleep(pScheduler.Get(), 300ms)));
+    });
+
+    std::this_thread::sleep_for(20ms);
+    auto start = JobClock::now();
+    auto value = SyncWait(Job::Run(pScheduler.Get(), [] {
+        return 42;
+    }));
+    auto elapsed = JobClock::now() - start;
+    blocking.join();
+
+    EXPECT_EQ(value, 42);
+    EXPECT_LT(elapsed, 200ms);
+}
+
+TEST(BlockingJobs, PoolGrowsAndShrinks)
+{
+    JobSchedulerDesc desc;
+    desc.WorkerCount               = 2;
+    desc.MaxBlockingThreadCount    = 2;
+    desc.BlockingThreadIdleTimeout = 20ms;
+    Ptr pScheduler                 = AllocateObject<JobScheduler>(desc);
+
+    std::atomic<int> running    = 0;
+    std::atomic<int> maxRunning = 0;
+    auto task                   = [&]() -> Task<> {
+        co_await Job::Run(pScheduler.Get());
+        co_await Job::RunBlocking(pScheduler.Get(), [&] {
+            auto count = ++running;
+            auto max   = maxRunning.load();
+            while (count > max && !maxRunning.compare_exchange_weak(max, count))
+            {
+            }
+
+            std::this_thread::sleep_for(10ms);
+            --running;
+        });
+    };
+
+    SyncWait(WhenAll(task(), task(), task(), task(), task()));
+    EXPECT_LE(maxRunning.load(), 2);
+    EXPECT_LE(pScheduler->GetBlockingThreadCount(), 2u);
+
+    // The idle threads exit after the timeout
+    auto deadline = JobClock::now() + 5s;
+    while (pScheduler->GetBlockingThreadCount() > 0 && JobClock::now() < deadline)
+    {
+        std::this_thread::sleep_for(5ms);
+    }
+
+    EXPECT_EQ(pScheduler->GetBlockingThreadCount(), 0u);
+}
+
+TEST(BlockingJobs, SyncWaitInBlockingJobs)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    // The blocking threads execute the scheduler's jobs while they wait, all at the same time
+    auto task = [&](int value) -> Task<int> {
+        co_await Job::Run(pScheduler.Get());
+        co_return co_await Job::RunBlocking(pScheduler.Get(), [&pScheduler, value] {
+            int sum = 0;
+            for (int i = 0; i < 100; ++i)
+            {
+                sum += SyncWait(Square(pScheduler.Get(), value), pScheduler.Get());
+            }
+
+            return sum;
+        });
+    };
+
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < 4; ++i)
+    {
+        tasks.push_back(task(i));
+    }
+
+    auto results = SyncWait(WhenAll(std::move(tasks)));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(results[i], 100 * i * i);
+    }
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobGraph.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/Task.h>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+TEST(JobGraph, Diamond)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    std::atomic<int> order = 0;
+    int top = -1, left = -1, right = -1, bottom = -1;
+
+    JobGraph graph;
+    auto topNode = graph.AddNode([&] {
+        top = order++;
+    });
+    auto leftNode = graph.AddNode([&] {
+        left = order++;
+    });
+    auto rightNode = graph.AddNode([&] {
+        right = order++;
+    });
+    auto bottomNode = graph.AddNode([&] {
+        bottom = order++;
+    });
+
+    graph.AddEdge(topNode, leftNode);
+    graph.AddEdge(topNode, rightNode);
+    graph.AddEdge(leftNode, bottomNode);
+    graph.AddEdge(rightNode, bottomNode);
+    graph.Compile();
+
+    for (int run = 0; run < 1000; ++run)
+    {
+        order = 0;
+        SyncWait(graph.RunAsync(pScheduler.Get()));
+
+        ASSERT_FALSE(graph.IsRunning());
+        ASSERT_EQ(top, 0);
+        ASSERT_LT(top, left);
+        ASSERT_LT(top, right);
+        ASSERT_EQ(bottom, 3);
+    }
+}
+
+TEST(JobGraph, EachNodeOncePerRun)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // Layers of nodes, every node depends on every node of the previous layer
+    constexpr USize layerCount = 8;
+    constexpr USize layerWidth = 40;
+    std::vector<std::atomic<int>> counters(layerCount * layerWidth);
+    std::vector<std::atomic<int>> completedLayers(layerCount);
+
+    JobGraph graph;
+    for (USize layer = 0; layer < layerCount; ++layer)
+    {
+        for (USize i = 0; i < layerWidth; ++i)
+        {
+            graph.AddNode([&, layer, i] {
+                if (layer > 0)
+                {
+                    EXPECT_EQ(completedLayers[layer - 1].load(), static_cast<int>(layerWidth));
+                }
+
+                ++counters[layer * layerWidth + i];
+                ++completedLayers[layer];
+            });
+        }
+    }
+
+    for (USize layer = 1; layer < layerCount; ++layer)
+    {
+        for (USize from = 0; from < layerWidth; ++from)
+        {
+            for (USize to = 0; to < layerWidth; ++to)
+            {
+                graph.AddEdge(
+                    static_cast<JobGraph::NodeID>((layer - 1) * layerWidth + from),
+                    static_cast<JobGraph::NodeID>(layer * layerWidth + to));
+            }
+        }
+    }
+
+    graph.Compile();
+
+    for (int run = 1; run <= 100; ++run)
+    {
+        for (auto& completed : completedLayers)
+        {
+            completed = 0;
+        }
+
+        SyncWait(graph.RunAsync(pScheduler.Get()));
+        for (auto& counter : counters)
+        {
+            ASSERT_EQ(counter.load(), run);
+        }
+    }
+}
+
+TEST(JobGraph, AwaitFromTask)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    std::atomic<int> sum = 0;
+    JobGraph graph;
+    auto first = graph.AddNode([&] {
+        sum += 1;
+    });
+    auto second = graph.AddNode([&] {
+        sum += 2;
+    });
+    graph.AddEdge(first, second);
+    graph.Compile();
+
+    auto task = [&]() -> Task<int> {
+        co_await graph.RunAsync(pScheduler.Get());
+        co_await graph.RunAsync(pScheduler.Get());
+        co_return sum.load();
+    };
+
+    EXPECT_EQ(SyncWait(task()), 6);
+}
+
+TEST(JobGraph, Empty)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    JobGraph graph;
+    graph.Compile();
+    SyncWait(graph.RunAsync(pScheduler.Get()));
+    EXPECT_FALSE(graph.IsRunning());
+}
@@ -0,0 +1,373 @@
+#include <Tests/Common/Common.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace UN::Async::Tests;
+
+namespace
+{
+    class CountingJob final : public Job
+    {
+        std::atomic<int>& m_Counter;
+        int m_Target;
+        Internal::ManualResetEvent* m_pEvent;
+
+        void Execute(const JobExecutionContext&) override
+        {
+            if (++m_Counter == m_Target && m_pEvent)
+            {
+                m_pEvent->Set();
+            }
+        }
+
+    public:
+        CountingJob(std::atomic<int>& counter, int target = 0, Internal::ManualResetEvent* pEvent = nullptr)
+            : m_Counter(counter)
+            , m_Target(target)
+            , m_pEvent(pEvent)
+        {
+        }
+    };
+} // namespace
+
+TEST(JobScheduler, RunOneTime)
+{
+    constexpr int jobCount = 10'000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::atomic<int> counter = 0;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&counter, &event]() {
+            if (++counter == jobCount)
+            {
+                event.Set();
+            }
+        });
+    }
+
+    event.Wait();
+    EXPECT_EQ(counter.load(), jobCount);
+}
+
+TEST(JobScheduler, RunOneTimeMoveOnly)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+    Internal::ManualResetEvent event;
+    auto pValue = std::make_unique<int>(42);
+    int result  = 0;
+
+    // Both the function and the arguments are moved into the job
+    Job::RunOneTime(
+        pScheduler.Get(),
+        [&result, &event](std::unique_ptr<int>& pValue) {
+            result = *pValue;
+            event.Set();
+        },
+        std::move(pValue));
+
+    event.Wait();
+    EXPECT_EQ(result, 42);
+}
+
+TEST(JobScheduler, InlineJob)
+{
+    struct DestructorCounter
+    {
+        std::shared_ptr<int> pCount;
+    };
+
+    auto pDestroyed = std::make_shared<int>(0);
+    int executed    = 0;
+    {
+        InlineJob job(
+            [&executed, counter = DestructorCounter{ pDestroyed }]() {
+                ++executed;
+            },
+            JobPriority::High);
+
+        EXPECT_EQ(job.GetPriority(), JobPriority::High);
+        EXPECT_EQ(pDestroyed.use_count(), 2);
+
+        job.ExecuteInternal(JobExecutionContext{ 0 });
+        EXPECT_EQ(executed, 1);
+    }
+
+    EXPECT_EQ(pDestroyed.use_count(), 1);
+
+    struct Large
+    {
+        char Data[InlineJob::PayloadSize + 1];
+
+        void operator()() {}
+    };
+
+    static_assert(InlineJob::Fits<void (*)()>);
+    static_assert(!InlineJob::Fits<Large>);
+}
+
+TEST(JobScheduler, FanOut)
+{
+    constexpr int successorCount = 1000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::atomic<int> parentCounter = 0;
+    std::atomic<int> counter       = 0;
+    Internal::ManualResetEvent event;
+
+    CountingJob parent(parentCounter);
+    std::vector<std::unique_ptr<CountingJob>> successors;
+    for (int i = 0; i < successorCount; ++i)
+    {
+        auto& successor = successors.emplace_back(std::make_unique<CountingJob>(counter, successorCount, &event));
+        successor->AttachParent(&parent);
+        successor->Schedule(pScheduler.Get());
+    }
+
+    EXPECT_EQ(counter.load(), 0);
+    parent.Schedule(pScheduler.Get());
+
+    event.Wait();
+    EXPECT_EQ(parentCounter.load(), 1);
+    EXPECT_EQ(counter.load(), successorCount);
+}
+
+TEST(JobScheduler, FanIn)
+{
+    // More parents than the old 13-bit dependency counter could hold
+    constexpr int parentCount = 10'000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::atomic<int> parentCounter = 0;
+    std::atomic<int> counter       = 0;
+    Internal::ManualResetEvent event;
+
+    CountingJob successor(counter, 1, &event);
+    std::vector<std::unique_ptr<CountingJob>> parents;
+    for (int i = 0; i < parentCount; ++i)
+    {
+        successor.AttachParent(parents.emplace_back(std::make_unique<CountingJob>(parentCounter)).get());
+    }
+
+    successor.Schedule(pScheduler.Get());
+    for (auto& parent : parents)
+    {
+        parent->Schedule(pScheduler.Get());
+    }
+
+    event.Wait();
+    EXPECT_EQ(parentCounter.load(), parentCount);
+    EXPECT_EQ(counter.load(), 1);
+}
+
+TEST(JobScheduler, WakeUpParkedWorkers)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (int i = 0; i < 10; ++i)
+    {
+        // Give the workers time to park
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        auto [a, b] = SyncWait(WhenAll(Square(pScheduler.Get(), i), Square(pScheduler.Get(), i + 1)));
+        EXPECT_EQ(a, i * i);
+        EXPECT_EQ(b, (i + 1) * (i + 1));
+    }
+}
+
+TEST(JobScheduler, Statistics)
+{
+    constexpr int jobCount = 10'000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::atomic<int> counter = 0;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&counter, &event]() {
+            if (++counter == jobCount)
+            {
+                event.Set();
+            }
+        });
+    }
+
+    event.Wait();
+
+    // The counters are updated after the jobs return, and the workers park some time after the queues are empty
+    JobSchedulerStatistics statistics;
+    JobWorkerStatistics total;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    do
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        statistics = pScheduler->GetStatistics();
+        total      = statistics.GetTotal();
+    }
+    while ((total.ExecutedJobs != static_cast<UInt64>(jobCount) || total.ParkCount == 0)
+           && std::chrono::steady_clock::now() < deadline);
+
+    ASSERT_EQ(statistics.Workers.Size(), 4u);
+    EXPECT_EQ(total.ExecutedJobs, static_cast<UInt64>(jobCount));
+    EXPECT_EQ(total.StolenJobs, total.JobsStolenByOthers);
+    EXPECT_LE(total.SuccessfulSteals, total.StolenJobs);
+    EXPECT_LE(total.GlobalQueueDequeues, static_cast<UInt64>(jobCount));
+    EXPECT_EQ(total.QueueDepth, 0u);
+    EXPECT_GT(total.ParkCount, 0u);
+    EXPECT_GE(total.GetStealSuccessRate(), 0.0);
+    EXPECT_LE(total.GetStealSuccessRate(), 1.0);
+    EXPECT_GE(total.GetStealsPerJob(), 0.0);
+    EXPECT_DOUBLE_EQ(total.GetStealsPerJob(),
+                     static_cast<double>(total.SuccessfulSteals + total.FailedSteals) / static_cast<double>(jobCount));
+    EXPECT_EQ(JobWorkerStatistics{}.GetStealsPerJob(), 0.0);
+}
+
+TEST(JobScheduler, PinnedWorkers)
+{
+    JobSchedulerDesc desc;
+    desc.WorkerCount = 4;
+    desc.PinWorkers  = true;
+    desc.Grouping    = JobWorkerGrouping::NumaNode;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(desc);
+    EXPECT_EQ(pScheduler->GetWorkerCount(), 4u);
+
+    auto [a, b] = SyncWait(WhenAll(Square(pScheduler.Get(), 3), Square(pScheduler.Get(), 4)));
+    EXPECT_EQ(a, 9);
+    EXPECT_EQ(b, 16);
+}
+
+namespace
+{
+    bool WaitForActiveWorkerCount(JobScheduler* pScheduler, UInt32 count)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (pScheduler->GetActiveWorkerCount() != count)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+} // namespace
+
+TEST(JobScheduler, LazyWorkers)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    EXPECT_EQ(pScheduler->GetWorkerCount(), 4u);
+    EXPECT_EQ(pScheduler->GetActiveWorkerCount(), 0u);
+
+    EXPECT_EQ(SyncWait(Square(pScheduler.Get(), 5)), 25);
+    EXPECT_GE(pScheduler->GetActiveWorkerCount(), 1u);
+    EXPECT_LE(pScheduler->GetActiveWorkerCount(), 4u);
+}
+
+TEST(JobScheduler, MinWorkerCount)
+{
+    JobSchedulerDesc desc;
+    desc.WorkerCount    = 4;
+    desc.MinWorkerCount = 2;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(desc);
+    EXPECT_EQ(pScheduler->GetActiveWorkerCount(), 2u);
+}
+
+TEST(JobScheduler, GrowAndShrink)
+{
+    JobSchedulerDesc desc;
+    desc.WorkerCount       = 4;
+    desc.MinWorkerCount    = 1;
+    desc.WorkerIdleTimeout = std::chrono::milliseconds(20);
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(desc);
+
+    // Jobs that keep their workers busy make the scheduler start the other workers
+    std::atomic<int> counter = 0;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < 4; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&counter, &event]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            if (++counter == 4)
+            {
+                event.Set();
+            }
+        });
+    }
+
+    event.Wait();
+    EXPECT_EQ(pScheduler->GetActiveWorkerCount(), 4u);
+
+    // The idle workers exit down to the minimum
+    EXPECT_TRUE(WaitForActiveWorkerCount(pScheduler.Get(), 1));
+    EXPECT_EQ(SyncWait(Square(pScheduler.Get(), 6)), 36);
+}
+
+TEST(JobScheduler, RestartStoppedWorkers)
+{
+    JobSchedulerDesc desc;
+    desc.WorkerCount       = 4;
+    desc.WorkerIdleTimeout = std::chrono::milliseconds(5);
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(desc);
+    for (UInt32 i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(WaitForActiveWorkerCount(pScheduler.Get(), 0));
+
+        // A pinned job restarts its worker
+        UInt32 executedOn = static_cast<UInt32>(-1);
+        Internal::ManualResetEvent event;
+        FunctionJob job([&] {
+            executedOn = pScheduler->GetWorkerID();
+            event.Set();
+        });
+
+        pScheduler->ScheduleJobOnWorker(&job, i);
+        event.Wait();
+        EXPECT_EQ(executedOn, i);
+    }
+
+    // A timer starts a worker to service it
+    ASSERT_TRUE(WaitForActiveWorkerCount(pScheduler.Get(), 0));
+    Internal::ManualResetEvent event;
+    FunctionJob job([&] {
+        event.Set();
+    });
+
+    job.ScheduleAt(pScheduler.Get(), JobClock::now() + std::chrono::milliseconds(10));
+    event.Wait();
+}
+
+TEST(JobScheduler, ManyWorkers)
+{
+    constexpr int jobCount = 10'000;
+
+    // More workers than the machine has processors and more than the scheduler used to allow
+    Ptr pScheduler = AllocateObject<JobScheduler>(128);
+    std::atomic<int> counter = 0;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&counter, &event]() {
+            if (++counter == jobCount)
+            {
+                event.Set();
+            }
+        });
+    }
+
+    event.Wait();
+    EXPECT_EQ(pScheduler->GetStatistics().Workers.Size(), 128u);
+    EXPECT_LE(pScheduler->GetActiveWorkerCount(), 128u);
+}
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/JobTimer.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <functional>
+#include <memory>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Task<JobClock::duration> MeasureDelay(IJobScheduler* pScheduler, JobClock::duration duration)
+    {
+        co_await Job::Run(pScheduler);
+
+        auto start = JobClock::now();
+        co_await Delay(pScheduler, duration);
+        co_return JobClock::now() - start;
+    }
+} // namespace
+
+TEST(JobTimer, Delay)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto elapsed = SyncWait(MeasureDelay(pScheduler.Get(), 20ms));
+    EXPECT_GE(elapsed, 20ms);
+    EXPECT_LT(elapsed, 2s);
+}
+
+TEST(JobTimer, ManyDelays)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    auto [a, b, c, d] = SyncWait(WhenAll(MeasureDelay(pScheduler.Get(), 30ms),
+                                         MeasureDelay(pScheduler.Get(), 1ms),
+                                         MeasureDelay(pScheduler.Get(), 10ms),
+                                         MeasureDelay(pScheduler.Get(), 0ms)));
+    EXPECT_GE(a, 30ms);
+    EXPECT_GE(b, 1ms);
+    EXPECT_GE(c, 10ms);
+    EXPECT_GE(d, 0ms);
+}
+
+TEST(JobTimer, DelayWhileWorkersBusy)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // The only worker keeps executing short jobs and must service the timer between them
+    std::atomic_bool isDone    = false;
+    std::atomic<int> remaining = 1;
+    Internal::ManualResetEvent busyEvent;
+    std::function<void()> busy = [&] {
+        if (!isDone.load())
+        {
+            remaining.fetch_add(1);
+            Job::RunOneTime(pScheduler.Get(), busy);
+        }
+
+        if (remaining.fetch_sub(1) == 1)
+        {
+            busyEvent.Set();
+        }
+    };
+
+    auto measure = [&]() -> Task<JobClock::duration> {
+        co_await Job::Run(pScheduler.Get());
+        Job::RunOneTime(pScheduler.Get(), busy);
+
+        auto start = JobClock::now();
+        co_await Delay(pScheduler.Get(), 5ms);
+        co_return JobClock::now() - start;
+    };
+
+    auto elapsed = SyncWait(measure());
+    isDone       = true;
+    busyEvent.Wait();
+
+    EXPECT_GE(elapsed, 5ms);
+    EXPECT_LT(elapsed, 2s);
+}
+
+TEST(JobTimer, ScheduleAt)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    Internal::ManualResetEvent event;
+    JobClock::time_point executedAt;
+    FunctionJob job([&] {
+        executedAt = JobClock::now();
+        event.Set();
+    });
+
+    auto deadline = JobClock::now() + 15ms;
+    job.ScheduleAt(pScheduler.Get(), deadline);
+    event.Wait();
+    EXPECT_GE(executedAt, deadline);
+}
+
+TEST(JobTimer, ScheduleAtWithParent)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    // The deadline passes first, the job still waits for its parent
+    std::atomic_bool isParentDone = false;
+    std::atomic_bool sawParent    = false;
+    Internal::ManualResetEvent event;
+    FunctionJob parent([&] {
+        isParentDone = true;
+    });
+    FunctionJob job([&] {
+        sawParent = isParentDone.load();
+        event.Set();
+    });
+
+    job.AttachParent(&parent);
+    job.ScheduleAt(pScheduler.Get(), JobClock::now());
+    std::this_thread::sleep_for(10ms);
+    parent.Schedule(pScheduler.Get());
+
+    event.Wait();
+    EXPECT_TRUE(sawParent.load());
+}
+
+TEST(JobTimer, PeriodicJob)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    std::atomic<int> count = 0;
+    Internal::ManualResetEvent event;
+    PeriodicJob job([&] {
+        if (++count == 5)
+        {
+            event.Set();
+        }
+    });
+
+    auto start = JobClock::now();
+    job.Start(pScheduler.Get(), 2ms);
+    EXPECT_TRUE(job.IsActive());
+    event.Wait();
+    job.Stop();
+
+    EXPECT_FALSE(job.IsActive());
+    EXPECT_GE(JobClock::now() - start, 10ms);
+
+    // No runs after Stop() returns
+    auto stoppedCount = count.load();
+    std::this_thread::sleep_for(10ms);
+    EXPECT_EQ(count.load(), stoppedCount);
+
+    // The job can be restarted
+    event.Reset();
+    job.Start(pScheduler.Get(), 1ms, 0ms);
+    while (count.load() < stoppedCount + 3)
+    {
+        std::this_thread::yield();
+    }
+}
+
+TEST(JobTimer, StopPeriodicJobRepeatedly)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    std::atomic<int> count = 0;
+    PeriodicJob job([&] {
+        ++count;
+    });
+
+    // Stop at random moments: while the timer is pending, queued or running
+    for (int i = 0; i < 200; ++i)
+    {
+        job.Start(pScheduler.Get(), 1ms, 0ms);
+        if (i % 2)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(i * 10));
+        }
+
+        job.Stop();
+        ASSERT_FALSE(job.IsActive());
+    }
+
+    auto stoppedCount = count.load();
+    std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(count.load(), stoppedCount);
+}
+
+TEST(JobTimer, DestroyPeriodicJobRepeatedly)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // A zero period re-schedules the job right away, the job is destroyed while the next run is starting
+    std::atomic<int> count = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        auto pJob = std::make_unique<PeriodicJob<std::function<void()>>>([&] {
+            ++count;
+        });
+
+        pJob->Start(pScheduler.Get(), 0ms, 0ms);
+        if (i % 2)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(i * 10));
+        }
+    }
+
+    EXPECT_GT(count.load(), 0);
+}
+
+TEST(JobTimer, PeriodicJobCancelledTree)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    JobTree tree;
+    std::atomic<int> count = 0;
+    PeriodicJob job([&] {
+        ++count;
+    });
+
+    job.AttachToTree(&tree);
+    job.Start(pScheduler.Get(), 1ms, 0ms);
+    while (count.load() < 3)
+    {
+        std::this_thread::yield();
+    }
+
+    // The next run is skipped and stops the job, Stop() must not wait for a run that never happens
+    tree.Cancel();
+    job.Stop();
+    EXPECT_FALSE(job.IsActive());
+
+    auto stoppedCount = count.load();
+    std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(count.load(), stoppedCount);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/JobTrace.h>
+#include <sstream>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    JobTraceEvent MakeEvent(UInt64 timestamp, JobTraceEventType type, JobTracePhase phase, const char* name = nullptr)
+    {
+        return JobTraceEvent{ timestamp, name, 0, type, phase };
+    }
+} // namespace
+
+TEST(JobTrace, BufferOverwritesOldestEvents)
+{
+    Internal::JobTraceBuffer buffer(8);
+    for (UInt64 i = 0; i < 20; ++i)
+    {
+        buffer.Write(MakeEvent(i, JobTraceEventType::Execute, JobTracePhase::Instant));
+    }
+
+    List<JobTraceEvent> events;
+    buffer.Read(events);
+    ASSERT_EQ(events.Size(), 8u);
+    for (USize i = 0; i < events.Size(); ++i)
+    {
+        EXPECT_EQ(events[i].Timestamp, 12 + i);
+    }
+}
+
+TEST(JobTrace, BufferRestart)
+{
+    Internal::JobTraceBuffer buffer(8);
+    buffer.Write(MakeEvent(0, JobTraceEventType::Execute, JobTracePhase::Begin));
+    buffer.Restart();
+    buffer.Write(MakeEvent(1, JobTraceEventType::Execute, JobTracePhase::End));
+
+    List<JobTraceEvent> events;
+    buffer.Read(events);
+    ASSERT_EQ(events.Size(), 1u);
+    EXPECT_EQ(events[0].Timestamp, 1u);
+}
+
+TEST(JobTrace, WriteChromeTrace)
+{
+    JobTrace trace;
+    auto& worker    = trace.Workers.Emplace();
+    worker.WorkerID = 3;
+    worker.Events.Push(MakeEvent(1000, JobTraceEventType::Execute, JobTracePhase::Begin, "Load \"mesh\""));
+    worker.Events.Push(MakeEvent(3500, JobTraceEventType::Execute, JobTracePhase::End));
+    worker.Events.Push(MakeEvent(4000, JobTraceEventType::Park, JobTracePhase::Begin));
+
+    std::stringstream stream;
+    WriteChromeTrace(trace, stream);
+    auto json = stream.str();
+
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Worker 3\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Load \\\"mesh\\\"\",\"cat\":\"job\",\"ph\":\"B\",\"ts\":0.000,\"pid\":0,\"tid\":3"),
+              std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"E\",\"ts\":2.500"), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Parked\""), std::string::npos);
+}
+
+#if UN_ASYNC_ENABLE_TRACING
+TEST(JobTrace, CollectFromScheduler)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+    pScheduler->StartTracing();
+
+    Internal::ManualResetEvent event;
+    Job::RunOneTime(pScheduler.Get(), [&event]() {
+        event.Set();
+    });
+    event.Wait();
+
+    pScheduler->StopTracing();
+    auto trace = pScheduler->CollectTrace();
+    ASSERT_EQ(trace.Workers.Size(), 2u);
+
+    USize executeCount = 0;
+    for (auto& worker : trace.Workers)
+    {
+        for (auto& traceEvent : worker.Events)
+        {
+            if (traceEvent.Type == JobTraceEventType::Execute && traceEvent.Phase == JobTracePhase::Begin)
+            {
+                ++executeCount;
+            }
+        }
+    }
+
+    EXPECT_EQ(executeCount, 1u);
+}
+#endif
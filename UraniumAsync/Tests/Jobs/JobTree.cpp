@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+TEST(JobTree, CancelPropagatesToChildren)
+{
+    JobTree root, child, grandChild, sibling;
+    root.AddChild(&child);
+    root.AddChild(&sibling);
+    child.AddChild(&grandChild);
+
+    child.Cancel();
+    EXPECT_FALSE(root.IsCancelled());
+    EXPECT_TRUE(child.IsCancelled());
+    EXPECT_TRUE(grandChild.IsCancelled());
+    EXPECT_FALSE(sibling.IsCancelled());
+
+    root.Cancel();
+    EXPECT_TRUE(sibling.IsCancelled());
+}
+
+TEST(JobTree, AddChildToCancelledTree)
+{
+    JobTree root, child;
+    root.Cancel();
+    root.AddChild(&child);
+    EXPECT_TRUE(child.IsCancelled());
+}
+
+TEST(JobTree, ConcurrentAddChildAndCancel)
+{
+    constexpr USize threadCount   = 4;
+    constexpr USize childrenCount = 1000;
+
+    JobTree root;
+    std::vector<JobTree> children(threadCount * childrenCount);
+    std::vector<std::thread> threads;
+    for (USize t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (USize i = 0; i < childrenCount; ++i)
+            {
+                root.AddChild(&children[t * childrenCount + i]);
+            }
+        });
+    }
+
+    root.Cancel();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // No child is lost and every child is cancelled, no matter if it was added before or after Cancel()
+    USize count = 0;
+    for (auto* pChild = root.GetFirstChild(); pChild; pChild = pChild->GetSibling())
+    {
+        ++count;
+    }
+
+    EXPECT_EQ(count, children.size());
+    for (auto& child : children)
+    {
+        ASSERT_TRUE(child.IsCancelled());
+    }
+}
+
+TEST(JobTree, CancelledJobsAreSkipped)
+{
+    constexpr int jobCount = 10'000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    JobTree tree;
+
+    std::atomic<int> executed = 0;
+    Internal::ManualResetEvent event;
+    auto* pGate = new FunctionJob([] {}, JobPriority::Normal, true);
+    auto* pSink = new FunctionJob(
+        [&event] {
+            event.Set();
+        },
+        JobPriority::Normal,
+        true);
+
+    for (int i = 0; i < jobCount; ++i)
+    {
+        auto* pJob = new FunctionJob(
+            [&executed] {
+                ++executed;
+            },
+            JobPriority::Normal,
+            true);
+
+        pJob->AttachToTree(&tree);
+        pJob->AttachParent(pGate);
+        pSink->AttachParent(pJob);
+        pJob->Schedule(pScheduler.Get());
+    }
+
+    // The jobs are ready to run only after the tree is cancelled, none of them should execute,
+    // but the sink that depends on all of them must still run
+    tree.Cancel();
+    pSink->Schedule(pScheduler.Get());
+    pGate->Schedule(pScheduler.Get());
+
+    event.Wait();
+    EXPECT_EQ(executed.load(), 0);
+}
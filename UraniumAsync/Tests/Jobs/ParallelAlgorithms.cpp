@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/ParallelAlgorithms.h>
+#include <UnAsync/SyncWait.h>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    std::vector<Int64> MakeRandomValues(USize count, UInt32 seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<Int64> distribution(-1000, 1000);
+
+        std::vector<Int64> result(count);
+        for (auto& value : result)
+        {
+            value = distribution(random);
+        }
+
+        return result;
+    }
+} // namespace
+
+TEST(ParallelAlgorithms, Reduce)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    auto values    = MakeRandomValues(100'000, 1);
+
+    auto sum = SyncWait(ParallelReduce(
+        pScheduler.Get(), USize{ 0 }, values.size(), Int64{ 0 },
+        [&values](USize i) {
+            return values[i];
+        },
+        std::plus<>{}));
+
+    EXPECT_EQ(sum, std::accumulate(values.begin(), values.end(), Int64{ 0 }));
+
+    auto empty = SyncWait(ParallelReduce(
+        pScheduler.Get(), 5, 5, 42,
+        [](int i) {
+            return i;
+        },
+        std::plus<>{}));
+    EXPECT_EQ(empty, 42);
+}
+
+TEST(ParallelAlgorithms, ReduceNonCommutative)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    ParallelAlgorithmDesc desc;
+    desc.BlockSize = 7;
+
+    // String concatenation is associative, but not commutative
+    auto result = SyncWait(ParallelReduce(
+        pScheduler.Get(), 0, 1000, std::string{},
+        [](int i) {
+            return std::to_string(i % 10);
+        },
+        std::plus<>{}, desc));
+
+    std::string expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        expected += std::to_string(i % 10);
+    }
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(ParallelAlgorithms, InclusiveScan)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (USize size : { 1, 511, 512, 513, 100'000 })
+    {
+        auto values = MakeRandomValues(size, 2);
+        std::vector<Int64> expected(size);
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+        std::vector<Int64> result(size);
+        SyncWait(ParallelInclusiveScan(pScheduler.Get(), values.begin(), values.end(), result.begin()));
+        EXPECT_EQ(result, expected);
+
+        // In place
+        SyncWait(ParallelInclusiveScan(pScheduler.Get(), values.begin(), values.end(), values.begin()));
+        EXPECT_EQ(values, expected);
+    }
+}
+
+TEST(ParallelAlgorithms, ExclusiveScan)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (USize size : { 1, 511, 512, 513, 100'000 })
+    {
+        auto values = MakeRandomValues(size, 3);
+        std::vector<Int64> expected(size);
+        std::exclusive_scan(values.begin(), values.end(), expected.begin(), Int64{ 10 });
+
+        std::vector<Int64> result(size);
+        SyncWait(ParallelExclusiveScan(pScheduler.Get(), values.begin(), values.end(), result.begin(), Int64{ 10 }));
+        EXPECT_EQ(result, expected);
+
+        SyncWait(ParallelExclusiveScan(pScheduler.Get(), values.begin(), values.end(), values.begin(), Int64{ 10 }));
+        EXPECT_EQ(values, expected);
+    }
+}
+
+TEST(ParallelAlgorithms, Sort)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (USize size : { 0, 1, 2, 1000, 100'000, 300'001 })
+    {
+        auto values   = MakeRandomValues(size, 4);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        SyncWait(ParallelSort(pScheduler.Get(), values.begin(), values.end()));
+        EXPECT_EQ(values, expected);
+    }
+}
+
+TEST(ParallelAlgorithms, SortIsStable)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    auto keys = MakeRandomValues(50'000, 5);
+    std::vector<std::pair<Int64, USize>> values;
+    for (USize i = 0; i < keys.size(); ++i)
+    {
+        values.emplace_back(keys[i] % 16, i);
+    }
+
+    auto compare = [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    };
+
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(), compare);
+
+    ParallelAlgorithmDesc desc;
+    desc.BlockSize = 1000;
+    SyncWait(ParallelSort(pScheduler.Get(), values.begin(), values.end(), compare, desc));
+    EXPECT_EQ(values, expected);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/ParallelFor.h>
+#include <UnAsync/SyncWait.h>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    class ParallelForTest : public ::testing::TestWithParam<ParallelForPartitioner>
+    {
+    };
+
+    void ExpectEachIndexOnce(const std::vector<std::atomic<int>>& counters)
+    {
+        for (USize i = 0; i < counters.size(); ++i)
+        {
+            ASSERT_EQ(counters[i].load(), 1) << "index " << i;
+        }
+    }
+} // namespace
+
+TEST_P(ParallelForTest, EachIndexOnce)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (USize grainSize : { 1, 7, 1000 })
+    {
+        std::vector<std::atomic<int>> counters(10'000);
+
+        ParallelForDesc desc;
+        desc.GrainSize   = grainSize;
+        desc.Partitioner = GetParam();
+        ParallelFor(
+            pScheduler.Get(), 0, static_cast<int>(counters.size()),
+            [&counters](int i) {
+                ++counters[i];
+            },
+            desc);
+
+        ExpectEachIndexOnce(counters);
+    }
+}
+
+TEST_P(ParallelForTest, ChunkBody)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::vector<std::atomic<int>> counters(5'000);
+
+    ParallelForDesc desc;
+    desc.GrainSize   = 64;
+    desc.Partitioner = GetParam();
+    ParallelFor(
+        pScheduler.Get(), USize{ 0 }, counters.size(),
+        [&counters](USize begin, USize end) {
+            EXPECT_LT(begin, end);
+            for (auto i = begin; i < end; ++i)
+            {
+                ++counters[i];
+            }
+        },
+        desc);
+
+    ExpectEachIndexOnce(counters);
+}
+
+TEST_P(ParallelForTest, Async)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    std::vector<std::atomic<int>> counters(10'000);
+
+    ParallelForDesc desc;
+    desc.Partitioner = GetParam();
+    SyncWait(ParallelForAsync(
+        pScheduler.Get(), -5'000, 5'000,
+        [&counters](int i) {
+            ++counters[i + 5'000];
+        },
+        desc));
+
+    ExpectEachIndexOnce(counters);
+}
+
+TEST_P(ParallelForTest, NoJobsLeftInQueues)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // Offers that weren't taken by thieves are reclaimed, but they must not outlive the loop in the queues
+    auto queueDepth = SyncWait(Job::Run(pScheduler.Get(), [&] {
+        ParallelForDesc desc;
+        desc.Partitioner = GetParam();
+        ParallelFor(pScheduler.Get(), 0, 10'000, [](int) {}, desc);
+
+        USize depth = 0;
+        for (auto& worker : pScheduler->GetStatistics().Workers)
+        {
+            depth += worker.QueueDepth;
+        }
+
+        return depth;
+    }));
+
+    EXPECT_EQ(queueDepth, 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(ParallelFor, ParallelForTest,
+                         ::testing::Values(ParallelForPartitioner::Adaptive, ParallelForPartitioner::Static,
+                                           ParallelForPartitioner::Simple));
+
+TEST(ParallelFor, EmptyRange)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+    int calls      = 0;
+    ParallelFor(pScheduler.Get(), 10, 10, [&calls](int) {
+        ++calls;
+    });
+    ParallelFor(pScheduler.Get(), 10, 5, [&calls](int) {
+        ++calls;
+    });
+
+    EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,152 @@
+#include <Tests/Common/Common.h>
+#include <UnAsync/AsyncEvent.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Jobs/JobTimer.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <thread>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace UN::Async::Tests;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Task<int> Fibonacci(IJobScheduler* pScheduler, int n)
+    {
+        co_await Job::Run(pScheduler);
+        if (n < 2)
+        {
+            co_return n;
+        }
+
+        // Deadlocks with few workers unless the waiting worker executes the nested jobs
+        auto [a, b] = SyncWait(WhenAll(Fibonacci(pScheduler, n - 1), Fibonacci(pScheduler, n - 2)));
+        co_return a + b;
+    }
+} // namespace
+
+TEST(SyncWait, AllWorkersWait)
+{
+    constexpr int jobCount = 16;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    // Every job waits for another job, more jobs than workers wait at the same time
+    std::atomic<int> sum = 0;
+    std::atomic<int> remaining = jobCount;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&, i] {
+            sum += SyncWait(Square(pScheduler.Get(), i));
+            if (--remaining == 0)
+            {
+                event.Set();
+            }
+        });
+    }
+
+    event.Wait();
+
+    int expected = 0;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        expected += i * i;
+    }
+
+    EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(SyncWait, NestedWaits)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+    EXPECT_EQ(SyncWait(Fibonacci(pScheduler.Get(), 12)), 144);
+}
+
+TEST(SyncWait, WaitForTimerOnWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // The only worker services the timer while it waits
+    auto value = SyncWait(Job::Run(pScheduler.Get(), [&] {
+        return SyncWait([&]() -> Task<int> {
+            co_await Delay(pScheduler.Get(), 5ms);
+            co_return 7;
+        }());
+    }));
+
+    EXPECT_EQ(value, 7);
+}
+
+TEST(SyncWait, ExternalThreadHelps)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // Keep the only worker busy, the waiting thread has to execute the job itself
+    std::atomic_bool isReleased = false;
+    Internal::ManualResetEvent busyEvent;
+    Job::RunOneTime(pScheduler.Get(), [&] {
+        busyEvent.Set();
+        while (!isReleased.load())
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    busyEvent.Wait();
+
+    auto threadID = SyncWait(Job::Run(pScheduler.Get(),
+                                      [] {
+                                          return std::this_thread::get_id();
+                                      }),
+                             pScheduler.Get());
+    isReleased = true;
+
+    EXPECT_EQ(threadID, std::this_thread::get_id());
+}
+
+TEST(SyncWait, TimersWhileExternalThreadHelps)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // The helper parks first, the wake-ups that hand the timers to the only worker must not go to it
+    AsyncEvent helperEvent;
+    std::thread helper([&] {
+        SyncWait(helperEvent, pScheduler.Get());
+    });
+
+    std::this_thread::sleep_for(10ms);
+
+    auto measure = [&]() -> Task<JobClock::duration> {
+        auto start = JobClock::now();
+        co_await Delay(pScheduler.Get(), 20ms);
+        co_return JobClock::now() - start;
+    };
+
+    auto elapsed = SyncWait(measure(), pScheduler.Get());
+    EXPECT_GE(elapsed, 20ms);
+    EXPECT_LT(elapsed, 2s);
+
+    Internal::ManualResetEvent event;
+    FunctionJob job([&] {
+        event.Set();
+    });
+
+    job.ScheduleAt(pScheduler.Get(), JobClock::now() + 5ms);
+    event.Wait();
+
+    helperEvent.Set();
+    helper.join();
+}
+
+TEST(SyncWait, DestroySchedulerAfterWait)
+{
+    // The worker that completes the task wakes up the waiter after setting the event, the scheduler must outlive it
+    for (int i = 0; i < 100; ++i)
+    {
+        Ptr pScheduler = AllocateObject<JobScheduler>(2);
+        EXPECT_EQ(SyncWait(Square(pScheduler.Get(), i), pScheduler.Get()), i * i);
+    }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/TimerWheel.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace std::chrono_literals;
+
+namespace
+{
+    std::vector<Internal::TimerWheelEntry*> ToVector(Internal::TimerWheelEntry* pExpired)
+    {
+        std::vector<Internal::TimerWheelEntry*> result;
+        for (; pExpired; pExpired = pExpired->pNext)
+        {
+            result.push_back(pExpired);
+        }
+
+        return result;
+    }
+} // namespace
+
+TEST(TimerWheel, ExpiresAtDeadline)
+{
+    auto start = JobClock::now();
+    Internal::TimerWheel wheel(start);
+
+    Internal::TimerWheelEntry entry;
+    entry.Deadline = start + 10ms;
+    wheel.Insert(&entry);
+    EXPECT_EQ(wheel.Size(), 1u);
+    EXPECT_EQ(wheel.GetTickTime(wheel.GetNextTick()), start + 10ms);
+
+    EXPECT_TRUE(ToVector(wheel.Advance(start + 9ms)).empty());
+    EXPECT_EQ(ToVector(wheel.Advance(start + 10ms)), std::vector{ &entry });
+    EXPECT_EQ(wheel.Size(), 0u);
+    EXPECT_FALSE(entry.IsLinked());
+    EXPECT_EQ(wheel.GetNextTick(), Internal::TimerWheel::NoTick);
+}
+
+TEST(TimerWheel, PastDeadline)
+{
+    auto start = JobClock::now();
+    Internal::TimerWheel wheel(start);
+    EXPECT_TRUE(ToVector(wheel.Advance(start + 100ms)).empty());
+
+    Internal::TimerWheelEntry entry;
+    entry.Deadline = start + 50ms;
+    EXPECT_FALSE(wheel.Insert(&entry));
+    EXPECT_FALSE(entry.IsLinked());
+
+    // The current tick hasn't been processed yet
+    entry.Deadline = start + 101ms;
+    EXPECT_TRUE(wheel.Insert(&entry));
+    EXPECT_EQ(ToVector(wheel.Advance(start + 101ms)), std::vector{ &entry });
+}
+
+TEST(TimerWheel, Remove)
+{
+    auto start = JobClock::now();
+    Internal::TimerWheel wheel(start);
+
+    Internal::TimerWheelEntry first, second, third;
+    first.Deadline  = start + 5ms;
+    second.Deadline = start + 5ms;
+    third.Deadline  = start + 10s;
+    wheel.Insert(&first);
+    wheel.Insert(&second);
+    wheel.Insert(&third);
+
+    EXPECT_TRUE(wheel.Remove(&second));
+    EXPECT_FALSE(wheel.Remove(&second));
+    EXPECT_TRUE(wheel.Remove(&third));
+    EXPECT_EQ(wheel.Size(), 1u);
+
+    EXPECT_EQ(ToVector(wheel.Advance(start + 1min)), std::vector{ &first });
+    EXPECT_FALSE(wheel.Remove(&first));
+}
+
+TEST(TimerWheel, RandomDeadlines)
+{
+    constexpr USize entryCount = 10'000;
+
+    auto start = JobClock::now();
+    Internal::TimerWheel wheel(start);
+
+    // Deadlines from a few milliseconds to far beyond the range of the wheel
+    std::mt19937_64 random(42);
+    std::vector<Internal::TimerWheelEntry> entries(entryCount);
+    for (auto& entry : entries)
+    {
+        auto exponent  = std::uniform_int_distribution<int>(0, 26)(random);
+        auto ticks     = std::uniform_int_distribution<Int64>(0, Int64{ 1 } << exponent)(random);
+        entry.Deadline = start + std::chrono::milliseconds(ticks);
+        wheel.Insert(&entry);
+    }
+
+    auto maxDeadline = std::max_element(entries.begin(), entries.end(), [](auto& lhs, auto& rhs) {
+                           return lhs.Deadline < rhs.Deadline;
+                       })->Deadline;
+
+    // Advance with irregular steps, every entry must expire exactly once and never before its deadline
+    USize expiredCount = 0;
+    auto now           = start;
+    while (now <= maxDeadline)
+    {
+        now += std::chrono::milliseconds(std::uniform_int_distribution<Int64>(1, 100'000)(random));
+        for (auto* pEntry : ToVector(wheel.Advance(now)))
+        {
+            ASSERT_LE(pEntry->Deadline, now);
+            ASSERT_FALSE(pEntry->IsLinked());
+            ++expiredCount;
+        }
+    }
+
+    EXPECT_EQ(expiredCount, entryCount);
+    EXPECT_EQ(wheel.Size(), 0u);
+}
+
+TEST(TimerWheel, NoLateExpiration)
+{
+    auto start = JobClock::now();
+    Internal::TimerWheel wheel(start);
+
+    std::vector<Internal::TimerWheelEntry> entries(300);
+    for (USize i = 0; i < entries.size(); ++i)
+    {
+        entries[i].Deadline = start + std::chrono::milliseconds(i * i * 7);
+        wheel.Insert(&entries[i]);
+    }
+
+    // Step through every tick, each entry must expire within one tick after its deadline
+    USize expiredCount = 0;
+    for (auto now = start; expiredCount < entries.size(); now += 1ms)
+    {
+        for (auto* pEntry : ToVector(wheel.Advance(now)))
+        {
+            ASSERT_LE(pEntry->Deadline, now);
+            ASSERT_GT(pEntry->Deadline + Internal::TimerWheel::TickDuration, now);
+            ++expiredCount;
+        }
+    }
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <algorithm>
+#include <latch>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Task<UInt32> SwitchAndGetWorkerID(IJobScheduler* pScheduler, UInt32 workerID)
+    {
+        co_await Job::Run(pScheduler);
+        co_await SwitchToWorker(pScheduler, workerID);
+        co_return pScheduler->GetWorkerID();
+    }
+
+    Task<> IncrementPinned(IJobScheduler* pScheduler, UInt32 workerID, int& counter, std::thread::id& threadID)
+    {
+        co_await Job::Run(pScheduler);
+        co_await SwitchToWorker(pScheduler, workerID);
+
+        // Only touched on one worker, so no synchronization is needed
+        ++counter;
+        threadID = std::this_thread::get_id();
+    }
+} // namespace
+
+TEST(WorkerMailbox, SwitchToWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+    for (UInt32 i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(SyncWait(SwitchAndGetWorkerID(pScheduler.Get(), i)), i);
+    }
+}
+
+TEST(WorkerMailbox, ThreadAffineStateWithoutLocks)
+{
+    constexpr int jobCount = 10'000;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // Jobs running on all the workers pin jobs to one worker, the pinned jobs touch the state without locks
+    int counter                    = 0;
+    std::atomic_bool isOtherThread = false;
+    std::thread::id pinnedThreadID;
+    Internal::ManualResetEvent event;
+    for (int i = 0; i < jobCount; ++i)
+    {
+        Job::RunOneTime(pScheduler.Get(), [&] {
+            auto* job = new FunctionJob(
+                [&] {
+                    if (counter == 0)
+                    {
+                        pinnedThreadID = std::this_thread::get_id();
+                    }
+                    else if (pinnedThreadID != std::this_thread::get_id())
+                    {
+                        isOtherThread = true;
+                    }
+
+                    if (++counter == jobCount)
+                    {
+                        event.Set();
+                    }
+                },
+                JobPriority::Normal,
+                true);
+            pScheduler->ScheduleJobOnWorker(job, 2);
+        });
+    }
+
+    event.Wait();
+    EXPECT_EQ(counter, jobCount);
+    EXPECT_FALSE(isOtherThread.load());
+}
+
+TEST(WorkerMailbox, SwitchManyCoroutines)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    int counter = 0;
+    std::thread::id a, b, c;
+    SyncWait(WhenAll(IncrementPinned(pScheduler.Get(), 1, counter, a),
+                     IncrementPinned(pScheduler.Get(), 1, counter, b),
+                     IncrementPinned(pScheduler.Get(), 1, counter, c)));
+    EXPECT_EQ(counter, 3);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(b, c);
+}
+
+TEST(WorkerMailbox, WakesParkedWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // Let all the workers park
+    std::this_thread::sleep_for(20ms);
+
+    for (UInt32 i = 0; i < 4; ++i)
+    {
+        UInt32 executedOn = static_cast<UInt32>(-1);
+        Internal::ManualResetEvent event;
+        FunctionJob job([&] {
+            executedOn = pScheduler->GetWorkerID();
+            event.Set();
+        });
+
+        pScheduler->ScheduleJobOnWorker(&job, i);
+        event.Wait();
+        EXPECT_EQ(executedOn, i);
+    }
+}
+
+TEST(WorkerMailbox, ExternalWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto mainID = pScheduler->RegisterExternalWorker();
+    EXPECT_GE(mainID, pScheduler->GetWorkerCount());
+    EXPECT_EQ(pScheduler->RegisterExternalWorker(), mainID);
+    EXPECT_EQ(pScheduler->GetWorkerID(), mainID);
+    EXPECT_EQ(pScheduler->PumpMailbox(), 0u);
+
+    auto mainThreadID = std::this_thread::get_id();
+    auto task         = [&]() -> Task<bool> {
+        co_await Job::Run(pScheduler.Get());
+        EXPECT_NE(std::this_thread::get_id(), mainThreadID);
+
+        co_await SwitchToWorker(pScheduler.Get(), mainID);
+        auto isOnMainThread = std::this_thread::get_id() == mainThreadID;
+
+        co_await SwitchToWorker(pScheduler.Get(), 0);
+        co_return isOnMainThread;
+    };
+
+    bool result = false;
+    std::thread waiter([&] {
+        result = SyncWait(task());
+    });
+
+    EXPECT_EQ(pScheduler->PumpMailbox(true), 1u);
+    waiter.join();
+    EXPECT_TRUE(result);
+}
+
+TEST(WorkerMailbox, SyncWaitOnExternalWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto mainID       = pScheduler->RegisterExternalWorker();
+    auto mainThreadID = std::this_thread::get_id();
+    auto task         = [&]() -> Task<bool> {
+        co_await Job::Run(pScheduler.Get());
+        co_await SwitchToWorker(pScheduler.Get(), mainID);
+        auto isOnMainThread = std::this_thread::get_id() == mainThreadID;
+
+        co_await SwitchToWorker(pScheduler.Get(), 0);
+        co_return isOnMainThread;
+    };
+
+    // The external worker runs its pinned jobs while it helps, nobody else can run them
+    EXPECT_TRUE(SyncWait(task(), pScheduler.Get()));
+}
+
+TEST(WorkerMailbox, TooManyExternalWorkers)
+{
+    constexpr UInt32 threadCount = JobScheduler::MaxExternalWorkerCount + 1;
+
+    Ptr pScheduler = AllocateObject<JobScheduler>(1);
+
+    // The threads stay alive until all of them are registered, so that their IDs aren't reused
+    std::latch registered(threadCount);
+    std::vector<UInt32> workerIDs(threadCount);
+    std::vector<std::thread> threads;
+    for (UInt32 i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&, i] {
+            workerIDs[i] = pScheduler->RegisterExternalWorker();
+            registered.arrive_and_wait();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::sort(workerIDs.begin(), workerIDs.end());
+    for (UInt32 i = 0; i < JobScheduler::MaxExternalWorkerCount; ++i)
+    {
+        EXPECT_EQ(workerIDs[i], pScheduler->GetWorkerCount() + i);
+    }
+
+    EXPECT_EQ(workerIDs.back(), static_cast<UInt32>(-1));
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Parallel/ConcurrentQueue.h>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+TEST(ConcurrentQueue, Empty)
+{
+    ConcurrentQueue<int*> queue;
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Dequeue(), nullptr);
+}
+
+TEST(ConcurrentQueue, Fifo)
+{
+    std::vector<int> values(5000);
+    ConcurrentQueue<int*> queue;
+    for (auto& value : values)
+    {
+        queue.Enqueue(&value);
+        EXPECT_FALSE(queue.Empty());
+    }
+
+    for (auto& value : values)
+    {
+        EXPECT_EQ(queue.Dequeue(), &value);
+    }
+
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Dequeue(), nullptr);
+}
+
+TEST(ConcurrentQueue, MultipleProducersMultipleConsumers)
+{
+    constexpr int valuesPerProducer = 20'000;
+    constexpr int producerCount     = 4;
+    constexpr int consumerCount     = 4;
+
+    std::vector<int> values(valuesPerProducer * producerCount);
+    std::vector<std::atomic<int>> taken(values.size());
+    std::atomic<int> takenCount = 0;
+    ConcurrentQueue<int*> queue;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producerCount; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < valuesPerProducer; ++j)
+            {
+                queue.Enqueue(&values[i * valuesPerProducer + j]);
+            }
+        });
+    }
+
+    for (int i = 0; i < consumerCount; ++i)
+    {
+        threads.emplace_back([&]() {
+            while (takenCount.load() < static_cast<int>(values.size()))
+            {
+                if (auto* value = queue.Dequeue())
+                {
+                    ++taken[value - values.data()];
+                    ++takenCount;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_TRUE(queue.Empty());
+    for (auto& count : taken)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Parallel/CpuTopology.h>
+#include <UnTL/Base/Platform.h>
+#include <thread>
+
+using namespace UN;
+using namespace UN::Async;
+
+TEST(CpuTopology, Query)
+{
+    auto cpus = QueryCpuTopology();
+    ASSERT_TRUE(cpus.Any());
+    for (USize i = 1; i < cpus.Size(); ++i)
+    {
+        EXPECT_LT(cpus[i - 1].ID, cpus[i].ID);
+    }
+}
+
+TEST(CpuTopology, PinCurrentThread)
+{
+    auto cpus = QueryCpuTopology();
+    ASSERT_TRUE(cpus.Any());
+
+    bool result = false;
+    std::thread thread([&]() {
+        result = PinCurrentThreadToCpu(cpus[cpus.Size() - 1].ID);
+    });
+    thread.join();
+
+    EXPECT_TRUE(result);
+}
+
+#if UN_LINUX
+TEST(CpuTopology, AffinityMask)
+{
+    auto cpus = QueryCpuTopology();
+    ASSERT_TRUE(cpus.Any());
+
+    // The processors outside of the affinity mask of the caller are skipped
+    List<CpuInfo> pinnedCpus;
+    std::thread thread([&]() {
+        if (PinCurrentThreadToCpu(cpus[cpus.Size() - 1].ID))
+        {
+            pinnedCpus = QueryCpuTopology();
+        }
+    });
+    thread.join();
+
+    ASSERT_EQ(pinnedCpus.Size(), 1u);
+    EXPECT_EQ(pinnedCpus[0].ID, cpus[cpus.Size() - 1].ID);
+}
+#endif
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Parallel/SmallObjectAllocator.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+using Internal::SmallObjectAllocator;
+
+TEST(SmallObjectAllocator, ReuseFreedBlock)
+{
+    auto* pFirst = SmallObjectAllocator::Allocate(40);
+    SmallObjectAllocator::Deallocate(pFirst);
+
+    auto* pSecond = SmallObjectAllocator::Allocate(48);
+    EXPECT_EQ(pFirst, pSecond);
+    SmallObjectAllocator::Deallocate(pSecond);
+}
+
+TEST(SmallObjectAllocator, Alignment)
+{
+    std::vector<void*> blocks;
+    for (USize size = 1; size <= SmallObjectAllocator::MaxSize * 2; size += 7)
+    {
+        auto* pBlock = SmallObjectAllocator::Allocate(size);
+        EXPECT_EQ(reinterpret_cast<USize>(pBlock) % SmallObjectAllocator::Alignment, 0u);
+        std::memset(pBlock, 0xCD, size);
+        blocks.push_back(pBlock);
+    }
+
+    for (auto* pBlock : blocks)
+    {
+        SmallObjectAllocator::Deallocate(pBlock);
+    }
+}
+
+TEST(SmallObjectAllocator, RemoteFreeReturnsToOwner)
+{
+    constexpr USize blockCount = 100;
+
+    // Use a new thread as the owner, so that its cache doesn't have free blocks yet
+    std::thread owner([]() {
+        std::vector<void*> blocks;
+        for (USize i = 0; i < blockCount; ++i)
+        {
+            blocks.push_back(SmallObjectAllocator::Allocate(100));
+        }
+
+        std::thread([&blocks]() {
+            for (auto* pBlock : blocks)
+            {
+                SmallObjectAllocator::Deallocate(pBlock);
+            }
+        }).join();
+
+        // The blocks freed by the other thread must be reused by the owner
+        std::vector<void*> reused;
+        for (USize i = 0; i < blockCount; ++i)
+        {
+            reused.push_back(SmallObjectAllocator::Allocate(100));
+        }
+
+        for (auto* pBlock : reused)
+        {
+            EXPECT_NE(std::find(blocks.begin(), blocks.end(), pBlock), blocks.end());
+            SmallObjectAllocator::Deallocate(pBlock);
+        }
+    });
+    owner.join();
+}
+
+TEST(SmallObjectAllocator, FreeAfterOwnerExit)
+{
+    std::vector<void*> blocks;
+    std::thread thread([&blocks]() {
+        for (USize i = 0; i < 100; ++i)
+        {
+            blocks.push_back(SmallObjectAllocator::Allocate(i));
+        }
+    });
+    thread.join();
+
+    for (auto* pBlock : blocks)
+    {
+        SmallObjectAllocator::Deallocate(pBlock);
+    }
+
+    // A new thread can reuse the cache of the exited thread
+    std::thread([]() {
+        auto* pBlock = SmallObjectAllocator::Allocate(64);
+        SmallObjectAllocator::Deallocate(pBlock);
+    }).join();
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Parallel/WorkStealingDeque.h>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+TEST(WorkStealingDeque, Empty)
+{
+    WorkStealingDeque<int*> deque;
+    EXPECT_TRUE(deque.Empty());
+    EXPECT_EQ(deque.Pop(), nullptr);
+    EXPECT_EQ(deque.Steal(), nullptr);
+}
+
+TEST(WorkStealingDeque, OwnerLifoThiefFifo)
+{
+    int values[3] = {};
+    WorkStealingDeque<int*> deque;
+    deque.Push(&values[0]);
+    deque.Push(&values[1]);
+    deque.Push(&values[2]);
+    EXPECT_EQ(deque.Size(), 3);
+
+    EXPECT_EQ(deque.Pop(), &values[2]);
+    EXPECT_EQ(deque.Steal(), &values[0]);
+    EXPECT_EQ(deque.Pop(), &values[1]);
+    EXPECT_TRUE(deque.Empty());
+}
+
+TEST(WorkStealingDeque, Grow)
+{
+    std::vector<int> values(1000);
+    WorkStealingDeque<int*> deque(4);
+    for (auto& value : values)
+    {
+        deque.Push(&value);
+    }
+
+    EXPECT_EQ(deque.Size(), values.size());
+    for (auto& value : values)
+    {
+        EXPECT_EQ(deque.Steal(), &value);
+    }
+
+    EXPECT_TRUE(deque.Empty());
+}
+
+TEST(WorkStealingDeque, ConcurrentSteal)
+{
+    constexpr int valueCount = 100'000;
+    constexpr int thiefCount = 3;
+    std::vector<std::atomic<int>> taken(valueCount);
+    std::vector<int> values(valueCount);
+    WorkStealingDeque<int*> deque(16);
+    std::atomic_bool done = false;
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < thiefCount; ++i)
+    {
+        thieves.emplace_back([&]() {
+            while (!done.load())
+            {
+                if (auto* value = deque.Steal())
+                {
+                    ++taken[value - values.data()];
+                }
+            }
+        });
+    }
+
+    for (auto& value : values)
+    {
+        deque.Push(&value);
+        if ((&value - values.data()) % 3 == 0)
+        {
+            if (auto* popped = deque.Pop())
+            {
+                ++taken[popped - values.data()];
+            }
+        }
+    }
+
+    while (auto* value = deque.Pop())
+    {
+        ++taken[value - values.data()];
+    }
+
+    done.store(true);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    for (auto& count : taken)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
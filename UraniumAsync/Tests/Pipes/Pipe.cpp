@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/Pipes/Pipe.h>
+#include <UnAsync/Pipes/PipeReader.h>
+#include <UnAsync/Pipes/PipeWriter.h>
+#include <UnAsync/WhenAll.h>
+#include <UnAsync/SyncWait.h>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    //! \brief Pipes are released by the jobs they schedule, so the scheduler must outlive them.
+    Ptr<IJobScheduler> GetScheduler()
+    {
+        static Ptr<IJobScheduler> pScheduler = AllocateObject<JobScheduler>(2);
+        return pScheduler;
+    }
+
+    Ptr<Pipe> CreatePipe(USize pauseWriterThreshold = 65536, USize resumeWriterThreshold = 32768)
+    {
+        PipeDesc desc;
+        desc.PauseWriterThreshold  = pauseWriterThreshold;
+        desc.ResumeWriterThreshold = resumeWriterThreshold;
+        desc.JobScheduler          = GetScheduler();
+        return AllocateObject<Pipe>(desc);
+    }
+
+    void Write(Pipe* pPipe, USize byteCount)
+    {
+        auto memory = pPipe->GetMemory(byteCount);
+        for (USize i = 0; i < byteCount; ++i)
+        {
+            memory[i] = static_cast<Byte>(i);
+        }
+
+        pPipe->Advance(byteCount);
+    }
+} // namespace
+
+TEST(Pipe, ReadBufferedDataSynchronously)
+{
+    Ptr pPipe = CreatePipe();
+    std::stop_token token;
+
+    Write(pPipe.Get(), 100);
+    auto flush = pPipe->FlushAsync(token);
+    EXPECT_TRUE(flush.IsCompletedSynchronously());
+    EXPECT_FALSE(SyncWait(std::move(flush)).IsCompleted());
+
+    auto sequence = SyncWait(pPipe->ReadAsync(token)).GetMemory();
+    EXPECT_EQ(sequence.GetLength(), 100u);
+
+    // Leave a part of the data unexamined, the next read doesn't have to wait for the writer
+    auto position = sequence.Seek(sequence.BeginPosition(), 40);
+    pPipe->AdvanceReader(position, position);
+
+    auto read = pPipe->ReadAsync(token);
+    EXPECT_TRUE(read.IsCompletedSynchronously());
+    EXPECT_EQ(SyncWait(std::move(read)).GetMemory().GetLength(), 60u);
+}
+
+TEST(Pipe, ReadWaitsForWriter)
+{
+    Ptr pPipe = CreatePipe();
+    std::stop_token token;
+
+    auto read = pPipe->ReadAsync(token);
+    EXPECT_FALSE(read.IsCompletedSynchronously());
+
+    Write(pPipe.Get(), 10);
+    SyncWait(pPipe->FlushAsync(token));
+    EXPECT_EQ(SyncWait(std::move(read)).GetMemory().GetLength(), 10u);
+}
+
+TEST(Pipe, ReaderResumesPausedWriter)
+{
+    Ptr pPipe = CreatePipe(64, 32);
+    std::stop_token token;
+
+    Write(pPipe.Get(), 100);
+    auto flush = pPipe->FlushAsync(token);
+    EXPECT_FALSE(flush.IsCompletedSynchronously());
+
+    // The flush wakes up the reader before it waits, otherwise neither side could make progress
+    auto sequence = SyncWait(pPipe->ReadAsync(token)).GetMemory();
+    EXPECT_EQ(sequence.GetLength(), 100u);
+    pPipe->AdvanceReader(sequence.EndPosition());
+
+    EXPECT_FALSE(SyncWait(std::move(flush)).IsCompleted());
+}
+
+TEST(Pipe, ReadSegments)
+{
+    constexpr USize chunkCount = 50;
+    constexpr USize chunkSize  = 1000;
+
+    Ptr pPipe = CreatePipe(4096, 2048);
+    std::stop_token token;
+
+    // The writer is paused and resumed many times, the data spans many segments
+    auto write = [&]() -> Task<> {
+        PipeWriter writer(pPipe.Get());
+        for (USize i = 0; i < chunkCount; ++i)
+        {
+            auto memory = writer.GetMemory(chunkSize);
+            for (USize j = 0; j < chunkSize; ++j)
+            {
+                memory[j] = static_cast<Byte>(i);
+            }
+
+            writer.Advance(chunkSize);
+            co_await writer.FlushAsync(token);
+        }
+
+        writer.Complete();
+    };
+
+    auto read = [&]() -> Task<USize> {
+        USize byteCount = 0;
+        auto segments   = ReadSegments(PipeReader(pPipe.Get()), token);
+        for (auto it = co_await segments.begin(); it != segments.end(); co_await ++it)
+        {
+            for (auto byte : *it)
+            {
+                EXPECT_EQ(byte, static_cast<Byte>(byteCount++ / chunkSize));
+            }
+        }
+
+        PipeReader(pPipe.Get()).Complete();
+        co_return byteCount;
+    };
+
+    auto [_, byteCount] = SyncWait(WhenAll(write(), read()));
+    EXPECT_EQ(byteCount, chunkCount * chunkSize);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Internal/CoroutineFrameAllocator.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <stdexcept>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    Task<USize> AwaitChain(USize depth)
+    {
+        if (depth == 0)
+        {
+            co_return 0;
+        }
+
+        co_return co_await AwaitChain(depth - 1) + 1;
+    }
+
+    Task<USize> ThrowingChain(USize depth)
+    {
+        if (depth == 0)
+        {
+            throw std::runtime_error("Chain");
+        }
+
+        co_return co_await ThrowingChain(depth - 1) + 1;
+    }
+
+    Task<USize> ScheduledChain(IJobScheduler* pScheduler, USize depth)
+    {
+        if (depth == 0)
+        {
+            co_await Job::Run(pScheduler);
+            co_return 0;
+        }
+
+        co_return co_await ScheduledChain(pScheduler, depth - 1) + 1;
+    }
+
+    class CountingAllocator final : public IAllocator
+    {
+    public:
+        USize AllocationCount   = 0;
+        USize DeallocationCount = 0;
+
+        void* Allocate(USize size, USize alignment) override
+        {
+            ++AllocationCount;
+            return SystemAllocator::Get()->Allocate(size, alignment);
+        }
+
+        void Deallocate(void* pointer) override
+        {
+            ++DeallocationCount;
+            SystemAllocator::Get()->Deallocate(pointer);
+        }
+    };
+
+    Task<int> Add(std::allocator_arg_t, IAllocator*, int lhs, int rhs)
+    {
+        co_return lhs + rhs;
+    }
+
+    struct Accumulator
+    {
+        int Sum = 0;
+
+        Task<int> Add(std::allocator_arg_t, IAllocator*, int value)
+        {
+            Sum += value;
+            co_return Sum;
+        }
+    };
+} // namespace
+
+TEST(Task, DeepAwaitChain)
+{
+    EXPECT_EQ(SyncWait(AwaitChain(1'000)), 1'000u);
+}
+
+TEST(Task, ExceptionThroughChain)
+{
+    EXPECT_THROW(SyncWait(ThrowingChain(1'000)), std::runtime_error);
+}
+
+TEST(Task, ChainCompletesOnWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto [a, b] = SyncWait(WhenAll(ScheduledChain(pScheduler.Get(), 1'000), AwaitChain(1'000)));
+    EXPECT_EQ(a, 1'000u);
+    EXPECT_EQ(b, 1'000u);
+}
+
+TEST(Task, FrameFromAllocator)
+{
+    CountingAllocator allocator;
+    EXPECT_EQ(SyncWait(Add(std::allocator_arg, &allocator, 2, 3)), 5);
+    EXPECT_EQ(allocator.AllocationCount, 1u);
+    EXPECT_EQ(allocator.DeallocationCount, 1u);
+
+    Accumulator accumulator;
+    EXPECT_EQ(SyncWait(accumulator.Add(std::allocator_arg, &allocator, 4)), 4);
+    EXPECT_EQ(SyncWait(accumulator.Add(std::allocator_arg, &allocator, 5)), 9);
+    EXPECT_EQ(allocator.AllocationCount, 3u);
+    EXPECT_EQ(allocator.DeallocationCount, 3u);
+}
+
+#if UN_ASYNC_ENABLE_TRACING
+TEST(Task, FrameStatistics)
+{
+    CountingAllocator allocator;
+
+    auto before = GetCoroutineFrameStatistics();
+    EXPECT_EQ(SyncWait(AwaitChain(10)), 10u);
+    EXPECT_EQ(SyncWait(Add(std::allocator_arg, &allocator, 1, 1)), 2);
+    auto after = GetCoroutineFrameStatistics();
+
+    EXPECT_GE(after.AllocationCount - before.AllocationCount, 12u);
+    EXPECT_GE(after.CustomAllocationCount - before.CustomAllocationCount, 1u);
+    EXPECT_GT(after.AllocatedBytes, before.AllocatedBytes);
+    EXPECT_GT(after.MaxFrameSize, 0u);
+}
+#endif
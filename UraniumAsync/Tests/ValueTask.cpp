@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/ValueTask.h>
+#include <UnAsync/WhenAll.h>
+#include <stdexcept>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    Task<int> ComputeOnWorker(IJobScheduler* pScheduler, int value)
+    {
+        co_await Job::Run(pScheduler);
+        co_return value;
+    }
+
+    Task<int> Throw()
+    {
+        throw std::runtime_error("ValueTask");
+        co_return 0;
+    }
+
+    //! \brief Complete synchronously for even values.
+    ValueTask<int> GetValue(IJobScheduler* pScheduler, int value)
+    {
+        if (value % 2 == 0)
+        {
+            return value;
+        }
+
+        return ComputeOnWorker(pScheduler, value);
+    }
+} // namespace
+
+TEST(ValueTask, ReadyValue)
+{
+    ValueTask<int> task = 5;
+    EXPECT_TRUE(task.IsCompletedSynchronously());
+    EXPECT_TRUE(task.IsReady());
+    EXPECT_EQ(SyncWait(std::move(task)), 5);
+}
+
+TEST(ValueTask, WrappedTask)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto task = GetValue(pScheduler.Get(), 7);
+    EXPECT_FALSE(task.IsCompletedSynchronously());
+    EXPECT_EQ(SyncWait(task), 7);
+}
+
+TEST(ValueTask, WhenAll)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto [a, b, c] = SyncWait(WhenAll(GetValue(pScheduler.Get(), 2), GetValue(pScheduler.Get(), 3),
+                                      GetValue(pScheduler.Get(), 4)));
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 3);
+    EXPECT_EQ(c, 4);
+}
+
+TEST(ValueTask, Exception)
+{
+    EXPECT_THROW(SyncWait(ValueTask<int>(Throw())), std::runtime_error);
+}
+
+TEST(ValueTask, Void)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    ValueTask<> completed;
+    EXPECT_TRUE(completed.IsCompletedSynchronously());
+    SyncWait(std::move(completed));
+
+    bool isExecuted = false;
+    SyncWait(ValueTask<>(Job::Run(pScheduler.Get(), [&] {
+        isExecuted = true;
+    })));
+    EXPECT_TRUE(isExecuted);
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <UnAsync/Jobs/JobScheduler.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/WhenAll.h>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace UN;
+using namespace UN::Async;
+
+namespace
+{
+    Task<USize> Square(USize value)
+    {
+        co_return value * value;
+    }
+
+    Task<USize> ScheduledSquare(IJobScheduler* pScheduler, USize value)
+    {
+        co_await Job::Run(pScheduler);
+        co_return value * value;
+    }
+
+    Task<> Increment(std::atomic<USize>& counter)
+    {
+        ++counter;
+        co_return;
+    }
+
+    Task<USize> ThrowIfOdd(USize value)
+    {
+        if (value % 2)
+        {
+            throw std::runtime_error("Odd");
+        }
+
+        co_return value;
+    }
+
+    std::vector<Task<USize>> MakeSquares(USize count)
+    {
+        std::vector<Task<USize>> tasks;
+        for (USize i = 0; i < count; ++i)
+        {
+            tasks.push_back(Square(i));
+        }
+
+        return tasks;
+    }
+} // namespace
+
+TEST(WhenAll, Vector)
+{
+    auto results = SyncWait(WhenAll(MakeSquares(100)));
+    ASSERT_EQ(results.size(), 100u);
+    for (USize i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i], i * i);
+    }
+}
+
+TEST(WhenAll, Empty)
+{
+    auto results = SyncWait(WhenAll(std::vector<Task<USize>>{}));
+    EXPECT_TRUE(results.empty());
+
+    auto tasks = SyncWait(WhenAllReady(std::vector<Task<>>{}));
+    EXPECT_TRUE(tasks.empty());
+}
+
+TEST(WhenAll, LvalueRange)
+{
+    // The tasks of an lvalue range are awaited by reference and keep their results
+    auto tasks   = MakeSquares(10);
+    auto results = SyncWait(WhenAll(tasks));
+    ASSERT_EQ(results.size(), 10u);
+    for (USize i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i].get(), i * i);
+        EXPECT_TRUE(tasks[i].IsReady());
+    }
+}
+
+TEST(WhenAll, View)
+{
+    auto results = SyncWait(WhenAll(std::views::iota(USize{ 0 }, USize{ 10 }) | std::views::transform(Square)));
+    ASSERT_EQ(results.size(), 10u);
+    EXPECT_EQ(results[9], 81u);
+}
+
+TEST(WhenAll, Void)
+{
+    std::atomic<USize> counter = 0;
+    std::vector<Task<>> tasks;
+    for (int i = 0; i < 10; ++i)
+    {
+        tasks.push_back(Increment(counter));
+    }
+
+    SyncWait(WhenAll(std::move(tasks)));
+    EXPECT_EQ(counter.load(), 10u);
+}
+
+TEST(WhenAll, Exception)
+{
+    std::vector<Task<USize>> tasks;
+    for (USize i = 0; i < 4; ++i)
+    {
+        tasks.push_back(ThrowIfOdd(i));
+    }
+
+    EXPECT_THROW(SyncWait(WhenAll(std::move(tasks))), std::runtime_error);
+
+    // WhenAllReady doesn't throw, the exceptions are kept in the tasks
+    tasks.clear();
+    for (USize i = 0; i < 4; ++i)
+    {
+        tasks.push_back(ThrowIfOdd(i));
+    }
+
+    auto readyTasks = SyncWait(WhenAllReady(std::move(tasks)));
+    EXPECT_EQ(readyTasks[0].GetResult(), 0u);
+    EXPECT_THROW(readyTasks[1].GetResult(), std::runtime_error);
+}
+
+TEST(WhenAll, ScheduledTasks)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    std::vector<Task<USize>> tasks;
+    for (USize i = 0; i < 1'000; ++i)
+    {
+        tasks.push_back(ScheduledSquare(pScheduler.Get(), i));
+    }
+
+    auto results = SyncWait(WhenAll(std::move(tasks)));
+    ASSERT_EQ(results.size(), 1'000u);
+    for (USize i = 0; i < results.size(); ++i)
+    {
+        ASSERT_EQ(results[i], i * i);
+    }
+}
+
+TEST(WhenAll, ParallelStart)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(4);
+
+    // The tasks don't suspend, each one runs on the thread that starts it
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    auto task = [&](USize value) -> Task<USize> {
+        {
+            std::lock_guard lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+
+        co_return value * value;
+    };
+
+    std::vector<Task<USize>> tasks;
+    for (USize i = 0; i < 1'000; ++i)
+    {
+        tasks.push_back(task(i));
+    }
+
+    auto results = SyncWait(WhenAll(pScheduler.Get(), std::move(tasks)));
+    ASSERT_EQ(results.size(), 1'000u);
+    for (USize i = 0; i < results.size(); ++i)
+    {
+        ASSERT_EQ(results[i], i * i);
+    }
+
+    // The last task is started on the awaiting thread, the others on the workers
+    EXPECT_TRUE(threads.contains(std::this_thread::get_id()));
+    EXPECT_GE(threads.size(), 2u);
+}
+
+TEST(WhenAll, ParallelStartFromWorker)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    auto sum = [&]() -> Task<USize> {
+        co_await Job::Run(pScheduler.Get());
+
+        std::vector<Task<USize>> tasks;
+        for (USize i = 0; i < 100; ++i)
+        {
+            tasks.push_back(ScheduledSquare(pScheduler.Get(), i));
+        }
+
+        auto results = co_await WhenAll(pScheduler.Get(), std::move(tasks));
+        co_return std::accumulate(results.begin(), results.end(), USize{ 0 });
+    };
+
+    EXPECT_EQ(SyncWait(sum()), 328'350u);
+}
+
+TEST(WhenAll, ParallelStartVoid)
+{
+    Ptr pScheduler = AllocateObject<JobScheduler>(2);
+
+    std::atomic<USize> counter = 0;
+    std::vector<Task<>> tasks;
+    for (int i = 0; i < 100; ++i)
+    {
+        tasks.push_back(Increment(counter));
+    }
+
+    SyncWait(WhenAll(pScheduler.Get(), std::move(tasks)));
+    EXPECT_EQ(counter.load(), 100u);
+
+    SyncWait(WhenAll(pScheduler.Get(), std::vector<Task<>>{}));
+}
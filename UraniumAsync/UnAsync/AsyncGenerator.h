@@ -0,0 +1,299 @@
+#pragma once
+#include <UnAsync/Internal/CoroutineFrameAllocator.h>
+#include <UnTL/Base/Base.h>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+
+namespace UN::Async
+{
+    template<class T>
+    class AsyncGenerator;
+
+    namespace Internal
+    {
+        template<class T>
+        class AsyncGeneratorPromise final
+        {
+            using coroutine_handle_t = std::coroutine_handle<AsyncGeneratorPromise>;
+
+            std::remove_reference_t<T>* m_pValue = nullptr;
+            std::exception_ptr m_Exception;
+            std::coroutine_handle<> m_Consumer;
+
+            //! \brief Suspends the producer and transfers execution to the consumer.
+            struct YieldAwaiter
+            {
+                [[nodiscard]] inline bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                inline std::coroutine_handle<> await_suspend(coroutine_handle_t coroutine) const noexcept
+                {
+                    return coroutine.promise().m_Consumer;
+                }
+
+                inline void await_resume() const noexcept {}
+            };
+
+        public:
+            using value_type = std::remove_cvref_t<T>;
+            using reference  = std::conditional_t<std::is_reference_v<T>, T, T&>;
+
+            inline static void* operator new(std::size_t size)
+            {
+                return CoroutineFrameAllocator::Allocate(size);
+            }
+
+            inline static void operator delete(void* pointer, std::size_t size) noexcept
+            {
+                CoroutineFrameAllocator::Deallocate(pointer, size);
+            }
+
+            inline AsyncGenerator<T> get_return_object() noexcept;
+
+            inline std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            inline YieldAwaiter final_suspend() noexcept
+            {
+                m_pValue = nullptr;
+                return {};
+            }
+
+            //! \brief The yielded object is not copied, it stays alive until the consumer asks for the next value.
+            inline YieldAwaiter yield_value(std::remove_reference_t<T>& value) noexcept
+            {
+                m_pValue = std::addressof(value);
+                return {};
+            }
+
+            inline YieldAwaiter yield_value(std::remove_reference_t<T>&& value) noexcept
+            {
+                m_pValue = std::addressof(value);
+                return {};
+            }
+
+            inline void unhandled_exception() noexcept
+            {
+                m_Exception = std::current_exception();
+            }
+
+            inline void return_void() noexcept {}
+
+            //! \brief Set the coroutine to transfer execution to when a value is yielded or the generator completes.
+            inline void SetConsumer(std::coroutine_handle<> consumer) noexcept
+            {
+                m_Consumer = consumer;
+            }
+
+            inline void RethrowIfException()
+            {
+                if (m_Exception)
+                {
+                    std::rethrow_exception(m_Exception);
+                }
+            }
+
+            [[nodiscard]] inline reference GetValue() const noexcept
+            {
+                return static_cast<reference>(*m_pValue);
+            }
+        };
+    } // namespace Internal
+
+    //! \brief A coroutine that produces a sequence of values asynchronously.
+    //!
+    //! The generator can both co_yield values and co_await other operations. It doesn't start until the consumer
+    //! awaits begin(), and after a value is consumed it doesn't resume until the consumer awaits the next one.
+    //! Values are passed by reference and never copied. The producer and the consumer hand execution to each other
+    //! by symmetric transfer, which compilers turn into tail calls in optimized builds.
+    //!
+    //! \code
+    //! for (auto it = co_await generator.begin(); it != generator.end(); co_await ++it)
+    //! {
+    //!     Process(*it);
+    //! }
+    //! \endcode
+    //!
+    //! \tparam T - Type of the values.
+    template<class T>
+    class [[nodiscard]] AsyncGenerator final
+    {
+    public:
+        using promise_type = Internal::AsyncGeneratorPromise<T>;
+
+    private:
+        using coroutine_handle_t = std::coroutine_handle<promise_type>;
+
+        coroutine_handle_t m_Coroutine;
+
+        //! \brief Resumes the producer until it yields the next value or completes.
+        struct AdvanceAwaiterBase
+        {
+            coroutine_handle_t m_Coroutine;
+
+            [[nodiscard]] inline bool await_ready() const noexcept
+            {
+                return !m_Coroutine;
+            }
+
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept
+            {
+                m_Coroutine.promise().SetConsumer(consumer);
+                return m_Coroutine;
+            }
+        };
+
+    public:
+        class Iterator final
+        {
+            friend class AsyncGenerator;
+
+            coroutine_handle_t m_Coroutine;
+
+            inline explicit Iterator(coroutine_handle_t coroutine) noexcept
+                : m_Coroutine(coroutine)
+            {
+            }
+
+            //! \return The iterator itself if the producer yielded a value, the end iterator if it completed.
+            inline Iterator& OnResumed()
+            {
+                if (m_Coroutine.done())
+                {
+                    auto coroutine = std::exchange(m_Coroutine, nullptr);
+                    coroutine.promise().RethrowIfException();
+                }
+
+                return *this;
+            }
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = typename promise_type::value_type;
+            using reference         = typename promise_type::reference;
+            using pointer           = std::add_pointer_t<reference>;
+
+            inline Iterator() noexcept = default;
+
+            //! \brief Resume the producer to get the next value.
+            //!
+            //! \return An awaitable that returns this iterator, which is equal to end() if there are no more values.
+            inline auto operator++() noexcept
+            {
+                struct Awaiter : AdvanceAwaiterBase
+                {
+                    Iterator* m_pIterator;
+
+                    inline Awaiter(Iterator* pIterator) noexcept
+                        : AdvanceAwaiterBase{ pIterator->m_Coroutine }
+                        , m_pIterator(pIterator)
+                    {
+                    }
+
+                    inline Iterator& await_resume()
+                    {
+                        return m_pIterator->OnResumed();
+                    }
+                };
+
+                UN_Assert(m_Coroutine, "Can't advance the end iterator");
+                return Awaiter{ this };
+            }
+
+            [[nodiscard]] inline reference operator*() const noexcept
+            {
+                return m_Coroutine.promise().GetValue();
+            }
+
+            [[nodiscard]] inline pointer operator->() const noexcept
+            {
+                return std::addressof(operator*());
+            }
+
+            [[nodiscard]] inline bool operator==(const Iterator& other) const noexcept
+            {
+                return m_Coroutine == other.m_Coroutine;
+            }
+        };
+
+        inline explicit AsyncGenerator(coroutine_handle_t coroutine) noexcept
+            : m_Coroutine(coroutine)
+        {
+        }
+
+        inline AsyncGenerator(AsyncGenerator&& other) noexcept
+            : m_Coroutine(std::exchange(other.m_Coroutine, nullptr))
+        {
+        }
+
+        inline AsyncGenerator& operator=(AsyncGenerator&& other) noexcept
+        {
+            if (std::addressof(other) != this)
+            {
+                if (m_Coroutine)
+                {
+                    m_Coroutine.destroy();
+                }
+
+                m_Coroutine = std::exchange(other.m_Coroutine, nullptr);
+            }
+
+            return *this;
+        }
+
+        inline AsyncGenerator(const AsyncGenerator&)            = delete;
+        inline AsyncGenerator& operator=(const AsyncGenerator&) = delete;
+
+        //! \brief Destroy the generator, the producer is destroyed at its last suspension point.
+        inline ~AsyncGenerator()
+        {
+            if (m_Coroutine)
+            {
+                m_Coroutine.destroy();
+            }
+        }
+
+        //! \brief Start the producer.
+        //!
+        //! \return An awaitable that returns an iterator to the first value or end() if there are no values.
+        inline auto begin() noexcept
+        {
+            struct Awaiter : AdvanceAwaiterBase
+            {
+                inline Iterator await_resume()
+                {
+                    Iterator iterator{ this->m_Coroutine };
+                    if (this->m_Coroutine)
+                    {
+                        iterator.OnResumed();
+                    }
+
+                    return iterator;
+                }
+            };
+
+            return Awaiter{ { m_Coroutine } };
+        }
+
+        [[nodiscard]] inline Iterator end() const noexcept
+        {
+            return Iterator{};
+        }
+    };
+
+    namespace Internal
+    {
+        template<class T>
+        inline AsyncGenerator<T> AsyncGeneratorPromise<T>::get_return_object() noexcept
+        {
+            return AsyncGenerator<T>{ std::coroutine_handle<AsyncGeneratorPromise>::from_promise(*this) };
+        }
+    } // namespace Internal
+} // namespace UN::Async
@@ -137,8 +137,10 @@ namespace UN::Async
 
             inline Iterator& operator++()
             {
+                // Move past the current buffer, then load the buffer at the new position
                 [[maybe_unused]] auto result = m_pSequence->TryGetNext(m_Current, m_CurrentBuffer);
                 UN_Assert(result, "Couldn't move");
+                m_pSequence->TryGetNext(m_Current, m_CurrentBuffer, false);
                 return *this;
             }
 
@@ -26,28 +26,53 @@ namespace UN
         }
 
         UN_FINLINE BoolPointer(T* pointer, bool boolean)
-            : m_Data(reinterpret_cast<Int64>(pointer) | (boolean ? 1 : 0))
+            : m_Data(reinterpret_cast<UInt64>(pointer) | (boolean ? 1 : 0))
         {
         }
 
         UN_FINLINE void SetPointer(T* pointer)
         {
-            auto value = m_Data.load(std::memory_order_consume) & BooleanMask;
-            m_Data.store(value | reinterpret_cast<Int64>(pointer), std::memory_order_acq_rel);
+            auto value = m_Data.load(std::memory_order_relaxed);
+            while (!m_Data.compare_exchange_weak(value, (value & BooleanMask) | reinterpret_cast<UInt64>(pointer)))
+            {
+            }
         }
 
-        UN_FINLINE void SetBool(bool boolean)
+        //! \brief Atomically replace the pointer if it's equal to the expected one, the boolean is preserved.
+        //!
+        //! \param expected - The expected pointer, receives the current pointer on failure.
+        //! \param desired - The pointer to store.
+        //!
+        //! \return True if the pointer was replaced.
+        UN_FINLINE bool CompareExchangePointer(T*& expected, T* desired)
         {
-            // The class is currently used only by JobTree, so the pointer can be changed only on one thread.
-            // The boolean value can be only set to true (cancelled state) and it is never going back.
-            // That's why this should be thread-safe
-            auto value = m_Data.load(std::memory_order_consume) & PointerMask;
-            m_Data.store(value | (boolean ? 1 : 0), std::memory_order_acq_rel);
+            auto value = m_Data.load(std::memory_order_relaxed);
+            while ((value & PointerMask) == reinterpret_cast<UInt64>(expected))
+            {
+                // Retry if only the boolean has changed
+                if (m_Data.compare_exchange_weak(value, (value & BooleanMask) | reinterpret_cast<UInt64>(desired)))
+                {
+                    return true;
+                }
+            }
+
+            expected = reinterpret_cast<T*>(value & PointerMask);
+            return false;
+        }
+
+        //! \brief Atomically set the boolean, the pointer is preserved.
+        //!
+        //! \return The previous value of the boolean.
+        UN_FINLINE bool SetBool(bool boolean)
+        {
+            auto previous = boolean ? m_Data.fetch_or(BooleanMask, std::memory_order_acq_rel)
+                                    : m_Data.fetch_and(PointerMask, std::memory_order_acq_rel);
+            return previous & BooleanMask;
         }
 
         [[nodiscard]] UN_FINLINE T* GetPointer(std::memory_order memoryOrder = std::memory_order_seq_cst) const
         {
-            return reinterpret_cast<T*>(m_Data.load(memoryOrder));
+            return reinterpret_cast<T*>(m_Data.load(memoryOrder) & PointerMask);
         }
 
         [[nodiscard]] UN_FINLINE bool GetBool(std::memory_order memoryOrder = std::memory_order_seq_cst) const
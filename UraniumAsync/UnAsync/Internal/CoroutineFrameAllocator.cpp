@@ -0,0 +1,103 @@
+#include <UnAsync/Internal/CoroutineFrameAllocator.h>
+#include <UnAsync/Parallel/SmallObjectAllocator.h>
+#include <UnTL/Base/Byte.h>
+#include <atomic>
+
+namespace UN::Async
+{
+    namespace
+    {
+        //! \return Offset of the allocator pointer stored after a frame.
+        inline USize GetAllocatorOffset(USize size) noexcept
+        {
+            constexpr USize alignment = alignof(IAllocator*);
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        inline IAllocator*& GetFrameAllocator(void* pFrame, USize size) noexcept
+        {
+            return *reinterpret_cast<IAllocator**>(static_cast<Byte*>(pFrame) + GetAllocatorOffset(size));
+        }
+
+#if UN_ASYNC_ENABLE_TRACING
+        struct FrameCounters final
+        {
+            std::atomic<UInt64> AllocationCount{ 0 };
+            std::atomic<UInt64> AllocatedBytes{ 0 };
+            std::atomic<UInt64> LargeAllocationCount{ 0 };
+            std::atomic<UInt64> CustomAllocationCount{ 0 };
+            std::atomic<USize> MaxFrameSize{ 0 };
+        };
+
+        FrameCounters Counters;
+
+        inline void CountAllocation(USize size) noexcept
+        {
+            Counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+            Counters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+            auto maxSize = Counters.MaxFrameSize.load(std::memory_order_relaxed);
+            while (maxSize < size && !Counters.MaxFrameSize.compare_exchange_weak(maxSize, size, std::memory_order_relaxed))
+            {
+            }
+        }
+#endif
+    } // namespace
+
+#if UN_ASYNC_ENABLE_TRACING
+    CoroutineFrameStatistics GetCoroutineFrameStatistics() noexcept
+    {
+        CoroutineFrameStatistics result;
+        result.AllocationCount       = Counters.AllocationCount.load(std::memory_order_relaxed);
+        result.AllocatedBytes        = Counters.AllocatedBytes.load(std::memory_order_relaxed);
+        result.LargeAllocationCount  = Counters.LargeAllocationCount.load(std::memory_order_relaxed);
+        result.CustomAllocationCount = Counters.CustomAllocationCount.load(std::memory_order_relaxed);
+        result.MaxFrameSize          = Counters.MaxFrameSize.load(std::memory_order_relaxed);
+        return result;
+    }
+#endif
+
+    namespace Internal
+    {
+        void* CoroutineFrameAllocator::Allocate(USize size)
+        {
+            auto allocationSize = GetAllocatorOffset(size) + sizeof(IAllocator*);
+#if UN_ASYNC_ENABLE_TRACING
+            CountAllocation(size);
+            if (allocationSize > SmallObjectAllocator::MaxSize)
+            {
+                Counters.LargeAllocationCount.fetch_add(1, std::memory_order_relaxed);
+            }
+#endif
+
+            auto* pFrame                    = SmallObjectAllocator::Allocate(allocationSize);
+            GetFrameAllocator(pFrame, size) = nullptr;
+            return pFrame;
+        }
+
+        void* CoroutineFrameAllocator::Allocate(USize size, IAllocator* pAllocator)
+        {
+            UN_Assert(pAllocator, "The allocator must not be null");
+#if UN_ASYNC_ENABLE_TRACING
+            CountAllocation(size);
+            Counters.CustomAllocationCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+            auto allocationSize             = GetAllocatorOffset(size) + sizeof(IAllocator*);
+            auto* pFrame                    = pAllocator->Allocate(allocationSize, SmallObjectAllocator::Alignment);
+            GetFrameAllocator(pFrame, size) = pAllocator;
+            return pFrame;
+        }
+
+        void CoroutineFrameAllocator::Deallocate(void* pFrame, USize size) noexcept
+        {
+            if (auto* pAllocator = GetFrameAllocator(pFrame, size))
+            {
+                pAllocator->Deallocate(pFrame);
+                return;
+            }
+
+            SmallObjectAllocator::Deallocate(pFrame);
+        }
+    } // namespace Internal
+} // namespace UN::Async
@@ -0,0 +1,53 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Memory/Memory.h>
+
+namespace UN::Async
+{
+#if UN_ASYNC_ENABLE_TRACING
+    //! \brief Counters of coroutine frame allocations.
+    struct CoroutineFrameStatistics
+    {
+        UInt64 AllocationCount       = 0; //!< Number of allocated frames.
+        UInt64 AllocatedBytes        = 0; //!< Total size of the allocated frames.
+        UInt64 LargeAllocationCount  = 0; //!< Number of frames too large for the thread caches.
+        UInt64 CustomAllocationCount = 0; //!< Number of frames allocated from an allocator passed with std::allocator_arg.
+        USize MaxFrameSize           = 0; //!< Size of the largest allocated frame.
+    };
+
+    //! \return The counters of all the task frames allocated since the start of the program.
+    //!
+    //! Only available when tracing is compiled in (UN_ASYNC_ENABLE_TRACING is set).
+    [[nodiscard]] CoroutineFrameStatistics GetCoroutineFrameStatistics() noexcept;
+#endif
+
+    namespace Internal
+    {
+        //! \brief Allocates coroutine frames of tasks.
+        //!
+        //! By default the frames come from the thread caches of SmallObjectAllocator, so short-lived tasks like
+        //! pipe reads and flushes don't call the system allocator in steady state. A frame can also be allocated
+        //! from an allocator provided by the caller. The allocator is stored right after the frame, so that
+        //! Deallocate() knows where to return it.
+        class CoroutineFrameAllocator final
+        {
+        public:
+            //! \brief Allocate a frame from the thread caches.
+            //!
+            //! \param size - Size of the frame in bytes.
+            static void* Allocate(USize size);
+
+            //! \brief Allocate a frame from an allocator.
+            //!
+            //! \param size       - Size of the frame in bytes.
+            //! \param pAllocator - The allocator to allocate the frame from.
+            static void* Allocate(USize size, IAllocator* pAllocator);
+
+            //! \brief Deallocate a frame. Can be called from any thread.
+            //!
+            //! \param pFrame - The frame returned by Allocate().
+            //! \param size   - Size of the frame in bytes, the same as passed to Allocate().
+            static void Deallocate(void* pFrame, USize size) noexcept;
+        };
+    } // namespace Internal
+} // namespace UN::Async
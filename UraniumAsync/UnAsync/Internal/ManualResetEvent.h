@@ -7,7 +7,8 @@ namespace UN::Async::Internal
 {
     class ManualResetEvent final
     {
-        std::atomic<UInt8> m_Value;
+        // futex compares 32-bit words, so the value must be a properly aligned 32-bit integer
+        std::atomic<Int32> m_Value;
 
     public:
         explicit ManualResetEvent(bool initial = false);
@@ -16,5 +17,10 @@ namespace UN::Async::Internal
         void Set() noexcept;
         void Reset() noexcept;
         void Wait() noexcept;
+
+        [[nodiscard]] inline bool IsSet() const noexcept
+        {
+            return m_Value.load(std::memory_order_acquire) != 0;
+        }
     };
 } // namespace UN::Async::Internal
@@ -1,5 +1,6 @@
 #pragma once
 #include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/IJobScheduler.h>
 #include <UnAsync/Traits.h>
 #include <coroutine>
 
@@ -14,6 +15,9 @@ namespace UN::Async::Internal
         using coroutine_handle_t = std::coroutine_handle<SyncWaitTaskPromise<TResult>>;
 
         ManualResetEvent* m_Event;
+        IJobScheduler* m_pScheduler;
+        SchedulerThreadInfo* m_pWaiter;
+        ManualResetEvent* m_pWokenEvent;
         std::remove_reference_t<TResult>* m_Result;
         std::exception_ptr m_Exception;
 
@@ -22,12 +26,31 @@ namespace UN::Async::Internal
 
         inline SyncWaitTaskPromise() noexcept {}
 
-        inline void Start(ManualResetEvent& event)
+        inline void Start(ManualResetEvent& event, IJobScheduler* pScheduler, ManualResetEvent* pWokenEvent)
         {
-            m_Event = &event;
+            m_Event       = &event;
+            m_pScheduler  = pScheduler;
+            m_pWaiter     = pScheduler ? pScheduler->GetCurrentThreadInfo() : nullptr;
+            m_pWokenEvent = pWokenEvent;
             coroutine_handle_t::from_promise(*this).resume();
         }
 
+        //! \brief Set the event and wake up the waiter if it helps a job scheduler.
+        inline void Notify() noexcept
+        {
+            // The waiter can destroy the promise as soon as the event is set, and the scheduler as soon as
+            // the woken event is set. Set() doesn't touch the event's memory after the store.
+            auto* pScheduler  = m_pScheduler;
+            auto* pWaiter     = m_pWaiter;
+            auto* pWokenEvent = m_pWokenEvent;
+            m_Event->Set();
+            if (pScheduler)
+            {
+                pScheduler->WakeHelper(pWaiter);
+                pWokenEvent->Set();
+            }
+        }
+
         inline auto get_return_object() noexcept
         {
             return coroutine_handle_t::from_promise(*this);
@@ -49,7 +72,7 @@ namespace UN::Async::Internal
 
                 inline void await_suspend(coroutine_handle_t coroutine) const noexcept
                 {
-                    coroutine.promise().m_Event->Set();
+                    coroutine.promise().Notify();
                 }
 
                 inline void await_resume() noexcept {}
@@ -91,17 +114,39 @@ namespace UN::Async::Internal
         using coroutine_handle_t = std::coroutine_handle<SyncWaitTaskPromise<void>>;
 
         ManualResetEvent* m_Event;
+        IJobScheduler* m_pScheduler;
+        SchedulerThreadInfo* m_pWaiter;
+        ManualResetEvent* m_pWokenEvent;
         std::exception_ptr m_Exception;
 
     public:
         inline SyncWaitTaskPromise() noexcept {}
 
-        inline void Start(ManualResetEvent& event)
+        inline void Start(ManualResetEvent& event, IJobScheduler* pScheduler, ManualResetEvent* pWokenEvent)
         {
-            m_Event = &event;
+            m_Event       = &event;
+            m_pScheduler  = pScheduler;
+            m_pWaiter     = pScheduler ? pScheduler->GetCurrentThreadInfo() : nullptr;
+            m_pWokenEvent = pWokenEvent;
             coroutine_handle_t::from_promise(*this).resume();
         }
 
+        //! \brief Set the event and wake up the waiter if it helps a job scheduler.
+        inline void Notify() noexcept
+        {
+            // The waiter can destroy the promise as soon as the event is set, and the scheduler as soon as
+            // the woken event is set. Set() doesn't touch the event's memory after the store.
+            auto* pScheduler  = m_pScheduler;
+            auto* pWaiter     = m_pWaiter;
+            auto* pWokenEvent = m_pWokenEvent;
+            m_Event->Set();
+            if (pScheduler)
+            {
+                pScheduler->WakeHelper(pWaiter);
+                pWokenEvent->Set();
+            }
+        }
+
         inline auto get_return_object() noexcept
         {
             return coroutine_handle_t::from_promise(*this);
@@ -124,7 +169,7 @@ namespace UN::Async::Internal
 
                 void await_suspend(coroutine_handle_t coroutine) const noexcept
                 {
-                    coroutine.promise().m_Event->Set();
+                    coroutine.promise().Notify();
                 }
 
                 void await_resume() noexcept {}
@@ -180,9 +225,15 @@ namespace UN::Async::Internal
         inline SyncWaitTask(const SyncWaitTask&)            = delete;
         inline SyncWaitTask& operator=(const SyncWaitTask&) = delete;
 
-        inline void Start(ManualResetEvent& event) noexcept
+        //! \brief Start the task.
+        //!
+        //! \param event - The event to set when the task completes.
+        //! \param pScheduler - The scheduler the waiter helps, nullptr if it just blocks.
+        //! \param pWokenEvent - The event to set after the waiter is woken up, required if pScheduler is set.
+        //!                      The waiter must wait for it before the scheduler can be destroyed.
+        inline void Start(ManualResetEvent& event, IJobScheduler* pScheduler, ManualResetEvent* pWokenEvent) noexcept
         {
-            m_Coroutine.promise().Start(event);
+            m_Coroutine.promise().Start(event, pScheduler, pWokenEvent);
         }
 
         inline decltype(auto) GetResult()
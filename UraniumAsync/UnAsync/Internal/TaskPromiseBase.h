@@ -1,13 +1,13 @@
 #pragma once
-#include <atomic>
+#include <UnAsync/Internal/CoroutineFrameAllocator.h>
 #include <coroutine>
+#include <memory>
 
 namespace UN::Async::Internal
 {
     class TaskPromiseBase
     {
         std::coroutine_handle<> m_Continuation;
-        std::atomic_bool m_State;
 
         struct FinalAwaiter
         {
@@ -16,23 +16,48 @@ namespace UN::Async::Internal
                 return false;
             }
 
+            //! \brief Transfer execution to the awaiting coroutine instead of resuming it on top of the stack.
             template<typename TPromise>
-            inline void await_suspend(std::coroutine_handle<TPromise> coroutine) noexcept
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> coroutine) noexcept
             {
                 TaskPromiseBase& promise = coroutine.promise();
-                if (promise.m_State.exchange(true, std::memory_order_acq_rel))
+                if (promise.m_Continuation)
                 {
-                    promise.m_Continuation.resume();
+                    return promise.m_Continuation;
                 }
+
+                return std::noop_coroutine();
             }
 
             inline void await_resume() noexcept {}
         };
 
     public:
-        inline TaskPromiseBase() noexcept
-            : m_State(false)
+        inline TaskPromiseBase() noexcept = default;
+
+        //! \brief Task frames are allocated for every call, so they are recycled through the thread caches.
+        inline static void* operator new(std::size_t size)
+        {
+            return CoroutineFrameAllocator::Allocate(size);
+        }
+
+        //! \brief Allocate the frame of a coroutine declared as Task<T> F(std::allocator_arg_t, IAllocator*, ...).
+        template<class... TArgs>
+        inline static void* operator new(std::size_t size, std::allocator_arg_t, IAllocator* pAllocator, TArgs&&...)
+        {
+            return CoroutineFrameAllocator::Allocate(size, pAllocator);
+        }
+
+        //! \brief Allocate the frame of a member coroutine declared as Task<T> F(std::allocator_arg_t, IAllocator*, ...).
+        template<class TThis, class... TArgs>
+        inline static void* operator new(std::size_t size, TThis&, std::allocator_arg_t, IAllocator* pAllocator, TArgs&&...)
+        {
+            return CoroutineFrameAllocator::Allocate(size, pAllocator);
+        }
+
+        inline static void operator delete(void* pointer, std::size_t size) noexcept
         {
+            CoroutineFrameAllocator::Deallocate(pointer, size);
         }
 
         inline auto initial_suspend() noexcept -> std::suspend_always
@@ -45,10 +70,10 @@ namespace UN::Async::Internal
             return {};
         }
 
-        inline bool TrySetContinuation(std::coroutine_handle<> continuation)
+        //! \brief Set the coroutine to resume when this one completes, must be called before the coroutine is started.
+        inline void SetContinuation(std::coroutine_handle<> continuation) noexcept
         {
             m_Continuation = continuation;
-            return !m_State.exchange(true, std::memory_order_acq_rel);
         }
     };
 } // namespace UN::Async::Internal
@@ -29,12 +29,15 @@ namespace UN::Async::Internal
             return m_Count.fetch_sub(1, std::memory_order_acq_rel) > 1;
         }
 
-        inline void NotifyAwaitableCompleted() noexcept
+        //! \return The awaiting coroutine if this was the last awaitable, a no-op coroutine otherwise.
+        [[nodiscard]] inline std::coroutine_handle<> NotifyAwaitableCompleted() noexcept
         {
             if (m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
             {
-                m_AwaitingCoroutine.resume();
+                return m_AwaitingCoroutine;
             }
+
+            return std::noop_coroutine();
         }
     };
 } // namespace UN::Async::Internal
@@ -1,5 +1,8 @@
 #pragma once
 #include <UnAsync/Internal/WhenAllCounter.h>
+#include <UnAsync/Jobs/Job.h>
+#include <iterator>
+#include <new>
 #include <tuple>
 
 namespace UN::Async::Internal
@@ -145,27 +148,93 @@ namespace UN::Async::Internal
 
         bool TryAwait(std::coroutine_handle<> awaitingCoroutine) noexcept
         {
-            for (auto&& task : m_Tasks)
+            if (m_pScheduler)
             {
-                task.Start(m_Counter);
+                StartTasksParallel();
+            }
+            else
+            {
+                for (auto&& task : m_Tasks)
+                {
+                    task.Start(m_Counter);
+                }
             }
 
             return m_Counter.TryAwait(awaitingCoroutine);
         }
 
+        //! \brief Submit all the tasks but the last one to the scheduler in batches and start the last one inline.
+        //!
+        //! The counter can't reach zero before TryAwait() decrements it, so the tasks stay alive until they all finish.
+        //! If a job can't be allocated, the remaining tasks are started inline: the tasks that were already submitted
+        //! reference the awaiter, so it can't throw.
+        void StartTasksParallel() noexcept
+        {
+            constexpr USize BatchSize = 32;
+
+            Job* batch[BatchSize];
+            USize batchSize = 0;
+
+            auto iter = m_Tasks.begin();
+            auto last = m_Tasks.empty() ? iter : std::prev(m_Tasks.end());
+            for (; iter != last; ++iter)
+            {
+                if (batchSize == BatchSize)
+                {
+                    m_pScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+                    batchSize = 0;
+                }
+
+                auto start = [pTask = &*iter, pCounter = &m_Counter]() noexcept {
+                    pTask->Start(*pCounter);
+                };
+
+                try
+                {
+                    batch[batchSize] = new InlineJob(std::move(start), JobPriority::Normal, true);
+                }
+                catch (const std::bad_alloc&)
+                {
+                    break;
+                }
+
+                ++batchSize;
+            }
+
+            if (batchSize == 1)
+            {
+                m_pScheduler->ScheduleJob(batch[0]);
+            }
+            else if (batchSize > 1)
+            {
+                m_pScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+            }
+
+            for (; iter != m_Tasks.end(); ++iter)
+            {
+                iter->Start(m_Counter);
+            }
+        }
+
         WhenAllCounter m_Counter;
         TTaskContainer m_Tasks;
+        IJobScheduler* m_pScheduler;
 
     public:
-        inline explicit WhenAllReadyAwaiter(TTaskContainer&& tasks) noexcept
+        //! \param tasks - The tasks to await.
+        //! \param pScheduler - The scheduler to start the tasks on in parallel, null to start them one by one
+        //!                     on the awaiting thread.
+        inline explicit WhenAllReadyAwaiter(TTaskContainer&& tasks, IJobScheduler* pScheduler = nullptr) noexcept
             : m_Counter(tasks.size())
             , m_Tasks(std::forward<TTaskContainer>(tasks))
+            , m_pScheduler(pScheduler)
         {
         }
 
         inline WhenAllReadyAwaiter(WhenAllReadyAwaiter&& other) noexcept(std::is_nothrow_move_constructible_v<TTaskContainer>)
             : m_Counter(other.m_Tasks.size())
             , m_Tasks(std::move(other.m_Tasks))
+            , m_pScheduler(other.m_pScheduler)
         {
         }
 
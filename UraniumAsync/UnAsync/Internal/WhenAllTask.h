@@ -50,9 +50,9 @@ namespace UN::Async::Internal
                     return false;
                 }
 
-                inline void await_suspend(coroutine_handle_t coroutine) const noexcept
+                inline std::coroutine_handle<> await_suspend(coroutine_handle_t coroutine) const noexcept
                 {
-                    coroutine.promise().m_Counter->NotifyAwaitableCompleted();
+                    return coroutine.promise().m_Counter->NotifyAwaitableCompleted();
                 }
 
                 inline void await_resume() const noexcept {}
@@ -127,9 +127,9 @@ namespace UN::Async::Internal
                     return false;
                 }
 
-                inline void await_suspend(coroutine_handle_t coroutine) const noexcept
+                inline std::coroutine_handle<> await_suspend(coroutine_handle_t coroutine) const noexcept
                 {
-                    coroutine.promise().m_Counter->NotifyAwaitableCompleted();
+                    return coroutine.promise().m_Counter->NotifyAwaitableCompleted();
                 }
 
                 inline void await_resume() const noexcept {}
@@ -1,9 +1,88 @@
 #pragma once
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/TimerWheel.h>
+#include <UnTL/Containers/ArraySlice.h>
+#include <UnTL/Containers/List.h>
 #include <UnTL/Memory/Memory.h>
+#include <chrono>
 
 namespace UN::Async
 {
     class Job;
+    class IJobScheduler;
+    struct SchedulerThreadInfo;
+
+    namespace Internal
+    {
+        //! \brief The scheduler whose worker runs on the calling thread, nullptr on other threads.
+        inline thread_local IJobScheduler* CurrentWorkerScheduler = nullptr;
+    } // namespace Internal
+
+    //! \brief A snapshot of counters of a single worker thread.
+    struct JobWorkerStatistics
+    {
+        UInt64 ExecutedJobs        = 0; //!< Number of jobs executed by the worker.
+        UInt64 CancelledJobs       = 0; //!< Number of jobs the worker skipped because their JobTree was cancelled.
+        UInt64 StolenJobs          = 0; //!< Number of jobs the worker stole from other workers.
+        UInt64 JobsStolenByOthers  = 0; //!< Number of jobs other workers stole from this worker.
+        UInt64 SuccessfulSteals    = 0; //!< Number of steal attempts that stole at least one job.
+        UInt64 FailedSteals        = 0; //!< Number of steal attempts that found nothing to steal.
+        UInt64 GlobalQueueDequeues = 0; //!< Number of jobs the worker took from the global queue.
+        UInt64 ParkCount           = 0; //!< Number of times the worker was parked.
+        UInt64 QueueDepth          = 0; //!< Number of jobs in the worker's queue at the moment of the snapshot.
+
+        std::chrono::nanoseconds ParkedTime{}; //!< Total time the worker spent parked.
+
+        //! \return Ratio of successful steal attempts to all steal attempts.
+        [[nodiscard]] inline double GetStealSuccessRate() const noexcept
+        {
+            auto attempts = SuccessfulSteals + FailedSteals;
+            return attempts ? static_cast<double>(SuccessfulSteals) / static_cast<double>(attempts) : 0.0;
+        }
+
+        //! \return Average number of steal attempts per executed job.
+        [[nodiscard]] inline double GetStealsPerJob() const noexcept
+        {
+            auto attempts = SuccessfulSteals + FailedSteals;
+            return ExecutedJobs ? static_cast<double>(attempts) / static_cast<double>(ExecutedJobs) : 0.0;
+        }
+
+        inline JobWorkerStatistics& operator+=(const JobWorkerStatistics& other) noexcept
+        {
+            ExecutedJobs += other.ExecutedJobs;
+            CancelledJobs += other.CancelledJobs;
+            StolenJobs += other.StolenJobs;
+            JobsStolenByOthers += other.JobsStolenByOthers;
+            SuccessfulSteals += other.SuccessfulSteals;
+            FailedSteals += other.FailedSteals;
+            GlobalQueueDequeues += other.GlobalQueueDequeues;
+            ParkCount += other.ParkCount;
+            QueueDepth += other.QueueDepth;
+            ParkedTime += other.ParkedTime;
+            return *this;
+        }
+    };
+
+    //! \brief A snapshot of counters of all worker threads of a job scheduler.
+    //!
+    //! The counters of different workers are read one by one without synchronization, so the snapshot
+    //! is not guaranteed to be consistent when the scheduler is busy.
+    struct JobSchedulerStatistics
+    {
+        List<JobWorkerStatistics> Workers; //!< Counters of each worker, indexed by worker ID.
+
+        //! \return Counters summed over all workers.
+        [[nodiscard]] inline JobWorkerStatistics GetTotal() const noexcept
+        {
+            JobWorkerStatistics result;
+            for (auto& worker : Workers)
+            {
+                result += worker;
+            }
+
+            return result;
+        }
+    };
 
     class IJobScheduler : public IObject
     {
@@ -14,5 +93,69 @@ namespace UN::Async
         [[nodiscard]] virtual UInt32 GetWorkerID() const    = 0;
 
         virtual void ScheduleJob(Job* job) = 0;
+
+        //! \brief Schedule multiple jobs at once.
+        //!
+        //! Works like calling ScheduleJob() for every job, but idle workers are notified once for the whole batch.
+        //!
+        //! \param jobs - The jobs to schedule.
+        virtual void ScheduleJobs(ArraySlice<Job* const> jobs) = 0;
+
+        //! \brief Schedule a job to be executed by a specific worker.
+        //!
+        //! The job is put into the worker's mailbox, a FIFO queue that other workers never steal from, so
+        //! state that is only touched by jobs pinned to one worker doesn't need locks. The mailbox is checked
+        //! before the worker's own queue, job priorities are ignored.
+        //!
+        //! \param job - The job to schedule, its dependency counter is not used.
+        //! \param workerID - ID of a worker thread or of a registered external worker. An unknown ID is
+        //!                   asserted, in builds without asserts the job is scheduled like ScheduleJob() does.
+        virtual void ScheduleJobOnWorker(Job* job, UInt32 workerID) = 0;
+
+        //! \brief Schedule a job that can block, e.g. on file I/O.
+        //!
+        //! Blocking jobs are executed by a separate pool of threads, so that they don't stall the workers.
+        //! The pool grows on demand up to a limit and its threads exit after being idle for a while.
+        //!
+        //! \param job - The job to schedule, its dependency counter is not used.
+        virtual void ScheduleBlockingJob(Job* job) = 0;
+
+        //! \brief Schedule the job of a timer entry after the entry's deadline.
+        //!
+        //! The timers are serviced by the workers, no thread is dedicated to them. The entry must stay alive
+        //! until its job is scheduled or the timer is cancelled.
+        //!
+        //! \param pEntry - The timer entry with the deadline and the job set.
+        virtual void StartTimer(Internal::TimerWheelEntry* pEntry) = 0;
+
+        //! \brief Cancel a timer started with StartTimer().
+        //!
+        //! \param pEntry - The timer entry.
+        //!
+        //! \return True if the timer was cancelled, false if it has already expired.
+        virtual bool CancelTimer(Internal::TimerWheelEntry* pEntry) = 0;
+
+        //! \brief Execute jobs on the calling thread until an event is set, used by SyncWait() instead of blocking.
+        //!
+        //! A worker of this scheduler keeps executing and stealing jobs as usual, so waiting on all workers can't
+        //! deadlock the scheduler. Other threads execute the jobs from the global queue and steal from the workers,
+        //! when they find nothing to do they sleep until the event is set.
+        //! The thread that sets the event must call WakeHelper() afterwards with the info of the waiting thread.
+        //!
+        //! \param event - The event to wait for.
+        virtual void HelpUntil(const Internal::ManualResetEvent& event) = 0;
+
+        //! \brief Get the info of the calling thread, other threads are registered on the first call.
+        [[nodiscard]] virtual SchedulerThreadInfo* GetCurrentThreadInfo() = 0;
+
+        //! \brief Wake up a thread parked in HelpUntil(), so that it checks its event.
+        //!
+        //! \param pThread - The info of the thread returned by GetCurrentThreadInfo() on that thread.
+        virtual void WakeHelper(SchedulerThreadInfo* pThread) = 0;
+
+        //! \brief Take a snapshot of the workers' counters.
+        //!
+        //! The counters are cheap to maintain and can be queried at any time from any thread.
+        [[nodiscard]] virtual JobSchedulerStatistics GetStatistics() const = 0;
     };
 } // namespace UN::Async
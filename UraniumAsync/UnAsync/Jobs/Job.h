@@ -1,9 +1,14 @@
 #pragma once
 #include <UnAsync/Jobs/IJobScheduler.h>
+#include <UnAsync/Jobs/JobTrace.h>
+#include <UnAsync/Jobs/JobSuccessorList.h>
 #include <UnAsync/Jobs/JobTree.h>
+#include <UnAsync/Parallel/SmallObjectAllocator.h>
 #include <UnAsync/Task.h>
 #include <UnTL/Memory/Memory.h>
 #include <coroutine>
+#include <cstddef>
+#include <new>
 
 namespace UN::Async
 {
@@ -20,6 +25,9 @@ namespace UN::Async
         Highest
     };
 
+    //! \brief Number of values in JobPriority enum.
+    inline constexpr USize JobPriorityCount = 4;
+
     struct JobExecutionContext
     {
         UN_RTTI_Struct(JobExecutionContext, "F1295370-E5FC-4D4B-B657-7A0158F2D22C");
@@ -32,46 +40,99 @@ namespace UN::Async
     //! Multiple jobs can be scheduled and processed in parallel. If a job depends on results of other jobs,
     //! it can be set as dependent of these jobs. The job stores its dependency counter which decreases when
     //! a parent job completes. When the counter reaches zero, the job is pushed onto the global queue.
+    //! A job can have any number of dependents, all of them that become ready when the job completes
+    //! are submitted to the scheduler in one batch.
     //!
     //! The default value of dependency counter is 1, so the job won't start immediately, but will wait for
     //! a call to `Schedule()` that will decrement the counter.
     class Job
     {
     protected:
+        //! \brief A function that executes a job without a virtual call.
+        using ExecuteFunction = void (*)(Job* pJob, const JobExecutionContext& context);
+
         BoolPointer<JobTree> m_TreeEmptyPair;
-        Job* m_Dependent = nullptr;
+        Internal::JobSuccessorList m_Successors;
         IJobScheduler* m_pScheduler;
 
-        inline UInt16 IncrementDependencyCount();
-        inline UInt16 DecrementDependencyCount();
+        //! \brief If set, called by ExecuteInternal() instead of the virtual Execute().
+        ExecuteFunction m_pExecuteFunction = nullptr;
+
+        inline UInt32 IncrementDependencyCount();
+        inline UInt32 DecrementDependencyCount();
 
     private:
-        std::atomic<UInt16> m_Flags{};
+        //! \brief Maximum number of ready successors submitted to the scheduler in one call.
+        inline static constexpr USize SuccessorBatchSize = 32;
+
+        std::atomic<UInt32> m_Flags{};
+
+#if UN_ASYNC_ENABLE_TRACING
+        const char* m_pTraceName = nullptr;
+#endif
+
+        inline static constexpr UInt32 PriorityBitCount        = 2;
+        inline static constexpr UInt32 IsOneTimeSubmitBitCount = 1;
+        inline static constexpr UInt32 DependencyCountBitCount = 32 - PriorityBitCount - IsOneTimeSubmitBitCount;
 
-        inline static constexpr UInt16 PriorityBitCount        = 2;
-        inline static constexpr UInt16 IsOneTimeSubmitBitCount = 1;
-        inline static constexpr UInt16 DependencyCountBitCount = 16 - PriorityBitCount - IsOneTimeSubmitBitCount;
+        inline static constexpr UInt32 DependencyCountShift = 0;
+        inline static constexpr UInt32 PriorityShift        = DependencyCountBitCount;
+        inline static constexpr UInt32 IsOneTimeSubmitShift = PriorityShift + PriorityBitCount;
 
-        inline static constexpr UInt16 DependencyCountShift = 0;
-        inline static constexpr UInt16 PriorityShift        = DependencyCountBitCount;
-        inline static constexpr UInt16 IsOneTimeSubmitShift = PriorityShift + PriorityBitCount;
+        inline static constexpr UInt32 DependencyCountMask = MakeMask(DependencyCountBitCount, DependencyCountShift);
+        inline static constexpr UInt32 PriorityMask        = MakeMask(PriorityBitCount, PriorityShift);
+        inline static constexpr UInt32 IsOneTimeSubmitMask = MakeMask(IsOneTimeSubmitBitCount, IsOneTimeSubmitShift);
 
-        inline static constexpr UInt16 DependencyCountMask = MakeMask(DependencyCountBitCount, DependencyCountShift);
-        inline static constexpr UInt16 PriorityMask        = MakeMask(PriorityBitCount, PriorityShift);
-        inline static constexpr UInt16 IsOneTimeSubmitMask = MakeMask(IsOneTimeSubmitBitCount, IsOneTimeSubmitShift);
+        //! \brief Decrement the dependency counters of the successors and schedule the ones that became ready.
+        inline static void ReleaseSuccessors(const Internal::JobSuccessorList& successors);
 
         //! \brief Synchronously run the job. Will be called from worker thread.
         //!
         //! \param context - The job's context used for execution.
         virtual void Execute(const JobExecutionContext& context) = 0;
 
+        //! \brief Called instead of Execute() when the job is skipped because its JobTree is cancelled.
+        //!
+        //! Like Execute(), can destroy the job.
+        virtual void OnCancelled() {}
+
     public:
         UN_RTTI_Class(Job, "69DA12B5-DFFC-4A38-BBB8-0018699C30BA");
 
         inline explicit Job(JobPriority priority = JobPriority::Normal, bool isEmpty = false, bool isOneTimeSubmit = false);
         virtual ~Job() = default;
 
-        inline void ExecuteInternal(const JobExecutionContext& context);
+        //! \brief Allocate a job from the thread-caching pool of small blocks.
+        //!
+        //! One-time jobs are allocated and deleted for every submission, so heap-allocated jobs don't go
+        //! through the global heap.
+        inline static void* operator new(std::size_t size)
+        {
+            return Internal::SmallObjectAllocator::Allocate(size);
+        }
+
+        inline static void operator delete(void* pointer) noexcept
+        {
+            Internal::SmallObjectAllocator::Deallocate(pointer);
+        }
+
+        //! \brief Over-aligned jobs don't fit the pool and use the global heap.
+        inline static void* operator new(std::size_t size, std::align_val_t alignment)
+        {
+            return ::operator new(size, alignment);
+        }
+
+        inline static void operator delete(void* pointer, std::align_val_t alignment) noexcept
+        {
+            ::operator delete(pointer, alignment);
+        }
+
+        //! \brief Execute the job and release its dependents.
+        //!
+        //! The body of a job attached to a cancelled JobTree is skipped, the dependents are released anyway.
+        //!
+        //! \return False if the job was skipped because of cancellation.
+        inline bool ExecuteInternal(const JobExecutionContext& context);
 
         //! \brief Attach job to a JobTree node.
         //!
@@ -81,7 +142,8 @@ namespace UN::Async
         //! \brief Add a parent job to depend on it.
         //!
         //! This function will increment dependency counter and the parent will decrement it when it completes.
-        //! A job can have multiple parents and won't be scheduled until all the parents signaled they're done.
+        //! A job can have multiple parents and won't be scheduled until all the parents signaled they're done,
+        //! and a parent can have multiple dependents. Must be called before the parent is scheduled.
         //!
         //! \param parent - Parent job to attach.
         inline void AttachParent(Job* parent);
@@ -95,6 +157,15 @@ namespace UN::Async
         //! \param pScheduler - Job scheduler.
         inline void Schedule(IJobScheduler* pScheduler);
 
+        //! \brief Schedule the job to a scheduler at a point in time.
+        //!
+        //! Works like Schedule(), but the dependency counter is decremented by a timer of the scheduler
+        //! when the deadline passes. The job must not be destroyed before that.
+        //!
+        //! \param pScheduler - Job scheduler.
+        //! \param deadline - The point in time to schedule the job at.
+        inline void ScheduleAt(IJobScheduler* pScheduler, JobClock::time_point deadline);
+
         //! \brief Schedule current coroutine to a scheduler.
         //!
         //! This function creates a SchedulerOperation job that is an awaitable type.
@@ -106,6 +177,18 @@ namespace UN::Async
         template<class TFunc, class... Args>
         inline static auto Run(IJobScheduler* pScheduler, TFunc f, Args&&... args) -> Task<std::invoke_result_t<TFunc, Args...>>;
 
+        //! \brief Call a function that can block on a separate pool of threads.
+        //!
+        //! The function is executed by a blocking thread of the scheduler, see IJobScheduler::ScheduleBlockingJob(),
+        //! and the awaiting coroutine is resumed on a worker, so the blocking pool only runs the function itself.
+        //!
+        //! \param pScheduler - Job scheduler.
+        //! \param f - The function to call.
+        //! \param args - The arguments to pass to the function.
+        template<class TFunc, class... Args>
+        inline static auto RunBlocking(IJobScheduler* pScheduler, TFunc f, Args&&... args)
+            -> Task<std::invoke_result_t<TFunc, Args...>>;
+
         template<class TFunc, class... Args>
         inline static void RunOneTime(IJobScheduler* pScheduler, TFunc f, Args... args);
 
@@ -117,12 +200,25 @@ namespace UN::Async
         //! \param priority - Priority to set for this job.
         inline void SetPriority(JobPriority priority);
 
+        //! \brief Set a name to show for the job in traces.
+        //!
+        //! Does nothing when tracing is compiled out (UN_ASYNC_ENABLE_TRACING is not set).
+        //!
+        //! \param name - The name of the job, the string must outlive the job.
+        inline void SetTraceName(const char* name);
+
+        //! \return The name of the job set by SetTraceName() or nullptr.
+        [[nodiscard]] inline const char* GetTraceName() const;
+
         [[nodiscard]] inline bool Empty() const;
 
         [[nodiscard]] inline bool IsOneTimeSubmit() const;
 
+        //! \return True if the job is attached to a cancelled JobTree.
+        [[nodiscard]] inline bool IsCancelled() const;
+
         //! \return Maximum number of dependencies a job can handle.
-        [[nodiscard]] static inline constexpr UInt16 GetMaxDependencyCount()
+        [[nodiscard]] static inline constexpr UInt32 GetMaxDependencyCount()
         {
             return DependencyCountMask >> DependencyCountShift;
         }
@@ -131,10 +227,10 @@ namespace UN::Async
     Job::Job(JobPriority priority, bool isEmpty, bool isOneTimeSubmit)
         : m_TreeEmptyPair(nullptr, isEmpty)
     {
-        UInt16 value = 0;
-        value |= static_cast<UInt16>(1) << DependencyCountShift;
-        value |= static_cast<UInt16>(priority) << PriorityShift;
-        value |= static_cast<UInt16>(isOneTimeSubmit ? 1 : 0) << IsOneTimeSubmitShift;
+        UInt32 value = 0;
+        value |= static_cast<UInt32>(1) << DependencyCountShift;
+        value |= static_cast<UInt32>(priority) << PriorityShift;
+        value |= static_cast<UInt32>(isOneTimeSubmit ? 1 : 0) << IsOneTimeSubmitShift;
         m_Flags.store(value, std::memory_order_relaxed);
     }
 
@@ -145,20 +241,21 @@ namespace UN::Async
 
     void Job::AttachParent(Job* parent)
     {
-        parent->m_Dependent = this;
-        IncrementDependencyCount();
+        [[maybe_unused]] auto count = IncrementDependencyCount();
+        UN_Assert(count != 0, "Too many dependencies");
+        parent->m_Successors.Add(this);
     }
 
     void Job::SetPriority(JobPriority priority)
     {
-        UInt16 cleared = m_Flags.load() & ~PriorityMask;
-        UInt16 value   = static_cast<UInt16>(priority) << PriorityShift;
+        UInt32 cleared = m_Flags.load() & ~PriorityMask;
+        UInt32 value   = static_cast<UInt32>(priority) << PriorityShift;
         m_Flags.store(value | cleared);
     }
 
     JobPriority Job::GetPriority() const
     {
-        UInt16 value = m_Flags.load() & PriorityMask;
+        UInt32 value = m_Flags.load() & PriorityMask;
         return static_cast<JobPriority>(value >> PriorityShift);
     }
 
@@ -168,12 +265,12 @@ namespace UN::Async
         DecrementDependencyCount();
     }
 
-    UInt16 Job::IncrementDependencyCount()
+    UInt32 Job::IncrementDependencyCount()
     {
         return (++m_Flags & DependencyCountMask) >> DependencyCountShift;
     }
 
-    UInt16 Job::DecrementDependencyCount()
+    UInt32 Job::DecrementDependencyCount()
     {
         auto value = (--m_Flags & DependencyCountMask) >> DependencyCountShift;
         if (value == 0)
@@ -181,22 +278,86 @@ namespace UN::Async
             m_pScheduler->ScheduleJob(this);
         }
 
-        return static_cast<UInt16>(value);
+        return value;
+    }
+
+    void Job::ReleaseSuccessors(const Internal::JobSuccessorList& successors)
+    {
+        Job* batch[SuccessorBatchSize];
+        USize batchSize                = 0;
+        IJobScheduler* pBatchScheduler = nullptr;
+
+        successors.ForEach([&](Job* pSuccessor) {
+            if ((--pSuccessor->m_Flags & DependencyCountMask) != 0)
+            {
+                return;
+            }
+
+            if (batchSize == SuccessorBatchSize || (batchSize > 0 && pSuccessor->m_pScheduler != pBatchScheduler))
+            {
+                pBatchScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+                batchSize = 0;
+            }
+
+            pBatchScheduler    = pSuccessor->m_pScheduler;
+            batch[batchSize++] = pSuccessor;
+        });
+
+        if (batchSize == 1)
+        {
+            pBatchScheduler->ScheduleJob(batch[0]);
+        }
+        else if (batchSize > 1)
+        {
+            pBatchScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+        }
     }
 
-    void Job::ExecuteInternal(const JobExecutionContext& context)
+    bool Job::ExecuteInternal(const JobExecutionContext& context)
     {
-        auto* dependent = m_Dependent;
+        // The job can be destroyed during execution, e.g. when it resumes a coroutine that owns it
+        auto successors = std::move(m_Successors);
         auto oneTime    = IsOneTimeSubmit();
-        Execute(context);
-        if (dependent)
+        auto cancelled  = IsCancelled();
+        if (!cancelled)
+        {
+            if (m_pExecuteFunction)
+            {
+                m_pExecuteFunction(this, context);
+            }
+            else
+            {
+                Execute(context);
+            }
+        }
+        else
         {
-            dependent->DecrementDependencyCount();
+            OnCancelled();
         }
+
+        ReleaseSuccessors(successors);
         if (oneTime)
         {
             delete this;
         }
+
+        return !cancelled;
+    }
+
+    void Job::SetTraceName([[maybe_unused]] const char* name)
+    {
+#if UN_ASYNC_ENABLE_TRACING
+        m_pTraceName = name;
+#endif
+    }
+
+    const char* Job::GetTraceName() const
+    {
+#if UN_ASYNC_ENABLE_TRACING
+        return m_pTraceName;
+#else
+        return nullptr;
+#endif
     }
 
     bool Job::Empty() const
@@ -206,10 +367,16 @@ namespace UN::Async
 
     bool Job::IsOneTimeSubmit() const
     {
-        UInt16 value = m_Flags.load() & IsOneTimeSubmitMask;
+        UInt32 value = m_Flags.load() & IsOneTimeSubmitMask;
         return value == IsOneTimeSubmitMask;
     }
 
+    bool Job::IsCancelled() const
+    {
+        auto* pTree = m_TreeEmptyPair.GetPointer(std::memory_order_relaxed);
+        return pTree && pTree->IsCancelled();
+    }
+
     template<class TFunc>
     class FunctionJob : public Job
     {
@@ -228,17 +395,148 @@ namespace UN::Async
         }
     };
 
+    //! \brief A job that stores a small callable inline and calls it without virtual dispatch.
+    //!
+    //! The callable is moved into a fixed-size buffer inside the job object and is invoked through a function
+    //! pointer set by the constructor, so executing the job reads only the job's own cache lines. The callable
+    //! must be nothrow move constructible and fit in PayloadSize bytes, see InlineJob::Fits.
+    class InlineJob final : public Job
+    {
+    public:
+        //! \brief Size of the inline buffer for the callable.
+        inline static constexpr USize PayloadSize = 64;
+
+        //! \brief True if a callable of type TFunc can be stored in an InlineJob.
+        template<class TFunc>
+        inline static constexpr bool Fits = sizeof(TFunc) <= PayloadSize && alignof(TFunc) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<TFunc> && std::is_invocable_v<TFunc&>;
+
+    private:
+        using DestroyFunction = void (*)(void* pPayload) noexcept;
+
+        alignas(std::max_align_t) std::byte m_Payload[PayloadSize];
+        DestroyFunction m_pDestroy = nullptr;
+
+        template<class TFunc>
+        inline static void Invoke(Job* pJob, const JobExecutionContext&)
+        {
+            auto* pFunction = std::launder(reinterpret_cast<TFunc*>(static_cast<InlineJob*>(pJob)->m_Payload));
+            (*pFunction)();
+        }
+
+        template<class TFunc>
+        inline static void Destroy(void* pPayload) noexcept
+        {
+            std::launder(reinterpret_cast<TFunc*>(pPayload))->~TFunc();
+        }
+
+        inline void Execute(const JobExecutionContext& context) override
+        {
+            m_pExecuteFunction(this, context);
+        }
+
+    public:
+        template<class TFunc>
+        requires(Fits<std::decay_t<TFunc>>) inline explicit InlineJob(TFunc&& function,
+                                                                      JobPriority priority = JobPriority::Normal,
+                                                                      bool isOneTimeSubmit = false)
+            : Job(priority, false, isOneTimeSubmit)
+        {
+            using TStored = std::decay_t<TFunc>;
+            new (m_Payload) TStored(std::forward<TFunc>(function));
+            m_pExecuteFunction = &Invoke<TStored>;
+            if constexpr (!std::is_trivially_destructible_v<TStored>)
+            {
+                m_pDestroy = &Destroy<TStored>;
+            }
+        }
+
+        InlineJob(const InlineJob&)            = delete;
+        InlineJob& operator=(const InlineJob&) = delete;
+
+        inline ~InlineJob() override
+        {
+            if (m_pDestroy)
+            {
+                m_pDestroy(m_Payload);
+            }
+        }
+    };
+
     template<class TFunc, class... Args>
     void Job::RunOneTime(IJobScheduler* pScheduler, TFunc f, Args... args)
     {
-        auto func = [f, args...]() {
+        auto func = [f = std::move(f), ... args = std::move(args)]() mutable {
             std::invoke(f, args...);
         };
 
-        auto* job = new FunctionJob(std::forward<decltype(func)>(func), JobPriority::Normal, true);
+        Job* job;
+        if constexpr (InlineJob::Fits<decltype(func)>)
+        {
+            job = new InlineJob(std::move(func), JobPriority::Normal, true);
+        }
+        else
+        {
+            job = new FunctionJob(std::move(func), JobPriority::Normal, true);
+        }
+
         pScheduler->ScheduleJob(job);
     }
 
+    namespace Internal
+    {
+        //! \brief A job that is scheduled by a timer of the job scheduler when its deadline passes.
+        class TimerJob : public Job
+        {
+        protected:
+            TimerWheelEntry m_TimerEntry;
+
+            //! \brief Start the timer, the job will be scheduled after the deadline.
+            //!
+            //! \param pScheduler - Job scheduler.
+            //! \param deadline - The point in time to schedule the job at.
+            inline void StartTimer(IJobScheduler* pScheduler, JobClock::time_point deadline)
+            {
+                m_pScheduler          = pScheduler;
+                m_TimerEntry.Deadline = deadline;
+                pScheduler->StartTimer(&m_TimerEntry);
+            }
+
+        public:
+            inline explicit TimerJob(JobPriority priority = JobPriority::Normal, bool isOneTimeSubmit = false)
+                : Job(priority, false, isOneTimeSubmit)
+            {
+                m_TimerEntry.pJob = this;
+            }
+        };
+
+        //! \brief A one-time timer job that schedules another job, used by Job::ScheduleAt().
+        class ScheduleAtJob final : public TimerJob
+        {
+            friend class UN::Async::Job;
+
+            Job* m_pTarget;
+
+            inline void Execute(const JobExecutionContext&) override
+            {
+                m_pTarget->Schedule(m_pScheduler);
+            }
+
+        public:
+            inline explicit ScheduleAtJob(Job* pTarget)
+                : TimerJob(pTarget->GetPriority(), true)
+                , m_pTarget(pTarget)
+            {
+            }
+        };
+    } // namespace Internal
+
+    void Job::ScheduleAt(IJobScheduler* pScheduler, JobClock::time_point deadline)
+    {
+        auto* pTimerJob = new Internal::ScheduleAtJob(this);
+        pTimerJob->StartTimer(pScheduler, deadline);
+    }
+
     class [[nodiscard]] SchedulerOperation : public Job
     {
         std::coroutine_handle<> m_AwaitingCoroutine;
@@ -274,6 +572,107 @@ namespace UN::Async
         return SchedulerOperation(pScheduler);
     }
 
+    //! \brief An awaitable that resumes the current coroutine on a blocking thread of a job scheduler.
+    class [[nodiscard]] BlockingOperation final : public Job
+    {
+        std::coroutine_handle<> m_AwaitingCoroutine;
+
+        inline void Execute(const JobExecutionContext&) override
+        {
+            m_AwaitingCoroutine.resume();
+        }
+
+    public:
+        inline explicit BlockingOperation(IJobScheduler* pScheduler) noexcept
+            : Job()
+        {
+            m_pScheduler = pScheduler;
+        }
+
+        [[nodiscard]] inline bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        inline void await_suspend(std::coroutine_handle<> awaitingCoroutine)
+        {
+            m_AwaitingCoroutine = awaitingCoroutine;
+            m_pScheduler->ScheduleBlockingJob(this);
+        }
+
+        inline void await_resume() noexcept {}
+    };
+
+    namespace Internal
+    {
+        template<class TFunc, class... Args>
+        inline auto RunOnBlockingThread(IJobScheduler* pScheduler, TFunc f, Args&&... args)
+            -> Task<std::invoke_result_t<TFunc, Args...>>
+        {
+            co_await BlockingOperation(pScheduler);
+            co_return std::invoke(f, std::forward<Args>(args)...);
+        }
+    } // namespace Internal
+
+    template<class TFunc, class... Args>
+    auto Job::RunBlocking(IJobScheduler* pScheduler, TFunc f, Args&&... args) -> Task<std::invoke_result_t<TFunc, Args...>>
+    {
+        auto task = Internal::RunOnBlockingThread(pScheduler, std::move(f), std::forward<Args>(args)...);
+        co_await task.WhenReady();
+
+        // Get the result or the exception only after returning to the workers
+        co_await Run(pScheduler);
+        co_return co_await std::move(task);
+    }
+
+    class [[nodiscard]] WorkerSwitchOperation final : public Job
+    {
+        std::coroutine_handle<> m_AwaitingCoroutine;
+        UInt32 m_WorkerID;
+
+        inline void Execute(const JobExecutionContext&) override
+        {
+            m_AwaitingCoroutine.resume();
+        }
+
+    public:
+        inline WorkerSwitchOperation(IJobScheduler* pScheduler, UInt32 workerID) noexcept
+            : Job()
+            , m_WorkerID(workerID)
+        {
+            m_pScheduler = pScheduler;
+        }
+
+        [[nodiscard]] inline bool await_ready() noexcept
+        {
+            // GetWorkerID() returns the invalid ID on threads that don't belong to the scheduler, it never matches.
+            // Unknown IDs go to ScheduleJobOnWorker() that asserts them.
+            UN_Assert(m_WorkerID != static_cast<UInt32>(-1), "Invalid worker ID");
+            return m_WorkerID != static_cast<UInt32>(-1) && m_pScheduler->GetWorkerID() == m_WorkerID;
+        }
+
+        inline void await_suspend(std::coroutine_handle<> awaitingCoroutine)
+        {
+            m_AwaitingCoroutine = awaitingCoroutine;
+            m_pScheduler->ScheduleJobOnWorker(this, m_WorkerID);
+        }
+
+        inline void await_resume() noexcept {}
+    };
+
+    //! \brief Resume the current coroutine on a specific worker of a job scheduler.
+    //!
+    //! The coroutine is pinned through the worker's mailbox, see IJobScheduler::ScheduleJobOnWorker().
+    //! Doesn't suspend if the coroutine already runs on that worker.
+    //!
+    //! \param pScheduler - Job scheduler.
+    //! \param workerID - ID of a worker thread or of a registered external worker, must not be static_cast<UInt32>(-1)
+    //!                   returned by a failed JobScheduler::RegisterExternalWorker().
+    inline WorkerSwitchOperation SwitchToWorker(IJobScheduler* pScheduler, UInt32 workerID)
+    {
+        return WorkerSwitchOperation(pScheduler, workerID);
+    }
+
     template<class TFunc, class... Args>
     auto Job::Run(IJobScheduler* pScheduler, TFunc f, Args&&... args) -> Task<std::invoke_result_t<TFunc, Args...>>
     {
@@ -0,0 +1,210 @@
+#include <UnAsync/Jobs/JobGraph.h>
+#include <UnTL/Memory/Memory.h>
+#include <cstring>
+
+namespace UN::Async
+{
+    namespace
+    {
+        //! \brief Maximum number of ready successors submitted to the scheduler in one call.
+        inline constexpr USize SuccessorBatchSize = 32;
+
+        static_assert(std::atomic_ref<UInt32>::required_alignment == alignof(UInt32));
+    } // namespace
+
+    void Internal::JobGraphNode::Execute(const JobExecutionContext&)
+    {
+        m_pGraph->ExecuteNode(m_Index);
+    }
+
+    JobGraph::~JobGraph()
+    {
+        UN_Assert(!IsRunning(), "The job graph is destroyed while running");
+
+        DestroyNodes();
+        for (auto* pTask : m_Tasks)
+        {
+            delete pTask;
+        }
+    }
+
+    void JobGraph::DestroyNodes() noexcept
+    {
+        if (m_pNodes == nullptr)
+        {
+            return;
+        }
+
+        for (USize i = 0; i < m_NodeCount; ++i)
+        {
+            m_pNodes[i].~JobGraphNode();
+        }
+
+        SystemAllocator::Get()->Deallocate(m_pNodes);
+        m_pNodes    = nullptr;
+        m_NodeCount = 0;
+    }
+
+    void JobGraph::AddEdge(NodeID from, NodeID to)
+    {
+        UN_Assert(from < m_Tasks.Size() && to < m_Tasks.Size(), "Invalid node ID");
+        m_IsCompiled = false;
+        m_Edges.Push(Edge{ from, to });
+    }
+
+    void JobGraph::Compile()
+    {
+        UN_Assert(!IsRunning(), "The job graph is compiled while running");
+
+        const auto nodeCount = m_Tasks.Size();
+
+        // Successors of every node in one array, the successors of node i are in [offsets[i], offsets[i + 1])
+        m_SuccessorOffsets.Clear();
+        m_SuccessorOffsets.Resize(nodeCount + 1, 0);
+        m_InitialCounts.Clear();
+        m_InitialCounts.Resize(nodeCount, 0);
+        for (auto& edge : m_Edges)
+        {
+            ++m_SuccessorOffsets[edge.From + 1];
+            ++m_InitialCounts[edge.To];
+        }
+
+        for (USize i = 0; i < nodeCount; ++i)
+        {
+            m_SuccessorOffsets[i + 1] += m_SuccessorOffsets[i];
+        }
+
+        List<UInt32> positions;
+        positions.Resize(nodeCount, 0);
+        m_Successors.Clear();
+        m_Successors.Resize(m_Edges.Size(), 0);
+        for (auto& edge : m_Edges)
+        {
+            m_Successors[m_SuccessorOffsets[edge.From] + positions[edge.From]++] = edge.To;
+        }
+
+        m_Counts.Clear();
+        m_Counts.Resize(nodeCount, 0);
+
+        DestroyNodes();
+        auto* allocator = SystemAllocator::Get();
+        m_pNodes        = static_cast<Internal::JobGraphNode*>(
+            allocator->Allocate(sizeof(Internal::JobGraphNode) * nodeCount, alignof(Internal::JobGraphNode)));
+        for (USize i = 0; i < nodeCount; ++i)
+        {
+            ::new (&m_pNodes[i]) Internal::JobGraphNode(this, static_cast<UInt32>(i), m_Priorities[i]);
+        }
+
+        m_NodeCount = nodeCount;
+
+        m_Roots.Clear();
+        for (USize i = 0; i < nodeCount; ++i)
+        {
+            if (m_InitialCounts[i] == 0)
+            {
+                m_Roots.Push(&m_pNodes[i]);
+            }
+        }
+
+        // Kahn's algorithm: every node of an acyclic graph is eventually reached from the roots
+        List<UInt32> counts;
+        counts.Resize(nodeCount, 0);
+        if (nodeCount > 0)
+        {
+            std::memcpy(counts.Data(), m_InitialCounts.Data(), nodeCount * sizeof(UInt32));
+        }
+
+        List<UInt32> ready;
+        for (auto* pRoot : m_Roots)
+        {
+            ready.Push(static_cast<UInt32>(static_cast<Internal::JobGraphNode*>(pRoot) - m_pNodes));
+        }
+
+        [[maybe_unused]] USize visitedCount = 0;
+        while (ready.Any())
+        {
+            auto index = ready.Pop();
+            ++visitedCount;
+            for (auto i = m_SuccessorOffsets[index]; i < m_SuccessorOffsets[index + 1]; ++i)
+            {
+                if (--counts[m_Successors[i]] == 0)
+                {
+                    ready.Push(m_Successors[i]);
+                }
+            }
+        }
+
+        UN_Assert(visitedCount == nodeCount, "The job graph has a cycle");
+
+        m_IsCompiled = true;
+    }
+
+    bool JobGraph::Start(IJobScheduler* pScheduler, std::coroutine_handle<> awaitingCoroutine)
+    {
+        UN_Assert(m_IsCompiled, "The job graph must be compiled before running");
+        [[maybe_unused]] auto wasRunning = m_IsRunning.exchange(true, std::memory_order_acquire);
+        UN_Assert(!wasRunning, "The job graph is already running");
+
+        m_pScheduler        = pScheduler;
+        m_AwaitingCoroutine = awaitingCoroutine;
+        std::memcpy(m_Counts.Data(), m_InitialCounts.Data(), m_NodeCount * sizeof(UInt32));
+
+        // One extra count keeps the graph alive until all the roots are submitted
+        m_PendingCount.store(m_NodeCount + 1, std::memory_order_relaxed);
+        pScheduler->ScheduleJobs(ArraySlice<Job* const>(m_Roots.Data(), m_Roots.Size()));
+        if (m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return true;
+        }
+
+        // All the nodes have already completed, e.g. they were executed inline, continue without suspending
+        m_IsRunning.store(false, std::memory_order_release);
+        return false;
+    }
+
+    void JobGraph::ExecuteNode(UInt32 index)
+    {
+        m_Tasks[index]->Run();
+
+        Job* batch[SuccessorBatchSize];
+        USize batchSize = 0;
+        for (auto i = m_SuccessorOffsets[index]; i < m_SuccessorOffsets[index + 1]; ++i)
+        {
+            auto successor = m_Successors[i];
+            if (std::atomic_ref<UInt32>(m_Counts[successor]).fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                continue;
+            }
+
+            if (batchSize == SuccessorBatchSize)
+            {
+                m_pScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+                batchSize = 0;
+            }
+
+            batch[batchSize++] = &m_pNodes[successor];
+        }
+
+        if (batchSize == 1)
+        {
+            m_pScheduler->ScheduleJob(batch[0]);
+        }
+        else if (batchSize > 1)
+        {
+            m_pScheduler->ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+        }
+
+        ReleaseNode();
+    }
+
+    void JobGraph::ReleaseNode() noexcept
+    {
+        // Counting every node, not only the sinks, guarantees that no worker touches the graph after the run ends
+        if (m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            auto awaitingCoroutine = m_AwaitingCoroutine;
+            m_IsRunning.store(false, std::memory_order_release);
+            awaitingCoroutine.resume();
+        }
+    }
+} // namespace UN::Async
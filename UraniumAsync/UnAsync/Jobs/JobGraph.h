@@ -0,0 +1,183 @@
+#pragma once
+#include <UnAsync/Jobs/IJobScheduler.h>
+#include <UnAsync/Jobs/Job.h>
+#include <UnTL/Containers/List.h>
+#include <atomic>
+#include <coroutine>
+
+namespace UN::Async
+{
+    class JobGraph;
+
+    namespace Internal
+    {
+        class IJobGraphTask
+        {
+        public:
+            virtual ~IJobGraphTask() = default;
+            virtual void Run()       = 0;
+        };
+
+        template<class TFunc>
+        class JobGraphTask final : public IJobGraphTask
+        {
+            TFunc m_Function;
+
+        public:
+            inline explicit JobGraphTask(TFunc&& function)
+                : m_Function(std::move(function))
+            {
+            }
+
+            inline void Run() override
+            {
+                m_Function();
+            }
+        };
+
+        class JobGraphNode final : public Job
+        {
+            JobGraph* m_pGraph;
+            UInt32 m_Index;
+
+            void Execute(const JobExecutionContext& context) override;
+
+        public:
+            inline JobGraphNode(JobGraph* pGraph, UInt32 index, JobPriority priority)
+                : Job(priority)
+                , m_pGraph(pGraph)
+                , m_Index(index)
+            {
+            }
+        };
+    } // namespace Internal
+
+    class [[nodiscard]] JobGraphRunOperation final
+    {
+        JobGraph& m_Graph;
+        IJobScheduler* m_pScheduler;
+
+    public:
+        inline JobGraphRunOperation(JobGraph& graph, IJobScheduler* pScheduler) noexcept
+            : m_Graph(graph)
+            , m_pScheduler(pScheduler)
+        {
+        }
+
+        [[nodiscard]] inline bool await_ready() const noexcept;
+        inline bool await_suspend(std::coroutine_handle<> awaitingCoroutine);
+        inline void await_resume() const noexcept {}
+    };
+
+    //! \brief A directed acyclic graph of jobs that is built once and can be executed many times.
+    //!
+    //! Nodes and edges are added first, then Compile() flattens the graph into arrays: the nodes, the successor
+    //! indices of every node and the initial dependency counters. A run only copies the initial counters with
+    //! a memcpy and submits the root nodes, it doesn't allocate memory. The counters are plain integers that are
+    //! updated with std::atomic_ref while the graph runs.
+    //!
+    //! Only one run of a graph can be in progress at a time. The graph must outlive the run.
+    class JobGraph final
+    {
+        friend class Internal::JobGraphNode;
+        friend class JobGraphRunOperation;
+
+        struct Edge
+        {
+            UInt32 From;
+            UInt32 To;
+        };
+
+        List<Internal::IJobGraphTask*> m_Tasks;
+        List<JobPriority> m_Priorities;
+        List<Edge> m_Edges;
+
+        Internal::JobGraphNode* m_pNodes = nullptr;
+        USize m_NodeCount                = 0;
+        List<UInt32> m_SuccessorOffsets;
+        List<UInt32> m_Successors;
+        List<UInt32> m_InitialCounts;
+        List<UInt32> m_Counts;
+        List<Job*> m_Roots;
+        bool m_IsCompiled = false;
+
+        IJobScheduler* m_pScheduler = nullptr;
+        std::coroutine_handle<> m_AwaitingCoroutine;
+        std::atomic<USize> m_PendingCount{ 0 };
+        std::atomic_bool m_IsRunning{ false };
+
+        void ExecuteNode(UInt32 index);
+        void ReleaseNode() noexcept;
+        bool Start(IJobScheduler* pScheduler, std::coroutine_handle<> awaitingCoroutine);
+        void DestroyNodes() noexcept;
+
+    public:
+        using NodeID = UInt32;
+
+        JobGraph() = default;
+        ~JobGraph();
+
+        JobGraph(const JobGraph&)            = delete;
+        JobGraph& operator=(const JobGraph&) = delete;
+
+        //! \brief Add a node that calls a function.
+        //!
+        //! \param function - The function to call on every run of the graph.
+        //! \param priority - Priority of the node's job.
+        //!
+        //! \return ID of the node to use in AddEdge().
+        template<class TFunc>
+        inline NodeID AddNode(TFunc function, JobPriority priority = JobPriority::Normal);
+
+        //! \brief Add a dependency: the second node will run after the first one completes.
+        //!
+        //! \param from - ID of the node to run first.
+        //! \param to - ID of the node to run after the first one.
+        void AddEdge(NodeID from, NodeID to);
+
+        //! \brief Flatten the graph for execution, must be called after the last change of the graph.
+        void Compile();
+
+        //! \return Number of nodes in the graph.
+        [[nodiscard]] inline USize GetNodeCount() const noexcept
+        {
+            return m_Tasks.Size();
+        }
+
+        //! \return True if a run of the graph is in progress.
+        [[nodiscard]] inline bool IsRunning() const noexcept
+        {
+            return m_IsRunning.load(std::memory_order_acquire);
+        }
+
+        //! \brief Run every node of the graph once.
+        //!
+        //! The graph starts when the operation is awaited, the awaiting coroutine is resumed on the worker
+        //! that completes the last node.
+        //!
+        //! \param pScheduler - The job scheduler to run the nodes on.
+        inline JobGraphRunOperation RunAsync(IJobScheduler* pScheduler)
+        {
+            return JobGraphRunOperation{ *this, pScheduler };
+        }
+    };
+
+    template<class TFunc>
+    JobGraph::NodeID JobGraph::AddNode(TFunc function, JobPriority priority)
+    {
+        m_IsCompiled = false;
+        m_Tasks.Push(new Internal::JobGraphTask<TFunc>(std::move(function)));
+        m_Priorities.Push(priority);
+        return static_cast<NodeID>(m_Tasks.Size() - 1);
+    }
+
+    bool JobGraphRunOperation::await_ready() const noexcept
+    {
+        return m_Graph.GetNodeCount() == 0;
+    }
+
+    bool JobGraphRunOperation::await_suspend(std::coroutine_handle<> awaitingCoroutine)
+    {
+        return m_Graph.Start(m_pScheduler, awaitingCoroutine);
+    }
+} // namespace UN::Async
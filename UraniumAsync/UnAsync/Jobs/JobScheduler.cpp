@@ -1,27 +1,112 @@
 #include <UnAsync/Jobs/JobScheduler.h>
+#include <algorithm>
+
+#if UN_ASYNC_ENABLE_TRACING
+#    define UN_JOB_TRACE(...) Trace(__VA_ARGS__)
+#else
+#    define UN_JOB_TRACE(...) static_cast<void>(0)
+#endif
 
 namespace UN::Async
 {
     thread_local SchedulerThreadInfo* JobScheduler::m_CurrentThreadInfo = nullptr;
+    thread_local UInt64 JobScheduler::m_CurrentSchedulerID           = 0;
+    thread_local bool JobScheduler::m_IsWorkerThread                 = false;
+
+    namespace
+    {
+        UInt32 GetGroupID(const CpuInfo& cpu, JobWorkerGrouping grouping)
+        {
+            switch (grouping)
+            {
+            case JobWorkerGrouping::L3Cache:
+                return cpu.L3CacheID;
+            case JobWorkerGrouping::NumaNode:
+                return cpu.NumaNodeID;
+            default:
+                return 0;
+            }
+        }
+
+        std::atomic<UInt64> NextSchedulerID = 1;
+
+        //! \brief Maximum number of expired timers submitted to the scheduler in one call.
+        inline constexpr USize TimerBatchSize = 32;
+    } // namespace
 
     JobScheduler::JobScheduler(UInt32 workerCount)
-        : m_WorkerCount(workerCount)
-        , m_SleepingWorkerCount(0)
+        : JobScheduler(JobSchedulerDesc{ workerCount })
+    {
+    }
+
+    JobScheduler::JobScheduler(const JobSchedulerDesc& desc)
+        : m_WorkerCount(desc.WorkerCount ? desc.WorkerCount : std::max(std::thread::hardware_concurrency(), 1u))
+        , m_MinWorkerCount(std::min(desc.MinWorkerCount, m_WorkerCount))
+        , m_WorkerIdleTimeout(desc.WorkerIdleTimeout)
         , m_ShouldExit(false)
+        , m_ID(NextSchedulerID.fetch_add(1, std::memory_order_relaxed))
+        , m_MaxBlockingThreadCount(desc.MaxBlockingThreadCount)
+        , m_BlockingThreadIdleTimeout(desc.BlockingThreadIdleTimeout)
     {
+        UN_Assert(m_MaxBlockingThreadCount > 0, "At least one blocking thread is required");
+
+        List<CpuInfo> cpus;
+        if (desc.PinWorkers)
+        {
+            // Sort the processors by group, so that workers with adjacent IDs share a cache or a NUMA node
+            cpus = QueryCpuTopology();
+            std::sort(cpus.begin(), cpus.end(), [&desc](const CpuInfo& lhs, const CpuInfo& rhs) {
+                auto lhsGroup = GetGroupID(lhs, desc.Grouping);
+                auto rhsGroup = GetGroupID(rhs, desc.Grouping);
+                return lhsGroup == rhsGroup ? lhs.ID < rhs.ID : lhsGroup < rhsGroup;
+            });
+        }
+
         auto* allocator = SystemAllocator::Get();
-        m_Threads.Reserve(256);
-        for (UInt32 i = 0; i < workerCount; ++i)
+        m_Workers.Reserve(m_WorkerCount);
+        m_IdleWorkers.Reserve(m_WorkerCount);
+        for (UInt32 i = 0; i < m_WorkerCount; ++i)
         {
-            auto* thread = new (allocator->Allocate(sizeof(SchedulerThreadInfo), 16)) SchedulerThreadInfo;
+            auto* thread = new (allocator->Allocate(sizeof(SchedulerThreadInfo), alignof(SchedulerThreadInfo)))
+                SchedulerThreadInfo;
 
             thread->WorkerID = i;
-            thread->Thread   = std::thread(&JobScheduler::WorkerThreadProcess, this, i);
-            thread->ThreadID = thread->Thread.get_id();
-            m_Threads.Push(thread);
+            thread->Random   = Internal::FastRandom(0x9E3779B9u * (i + 1));
+#if UN_ASYNC_ENABLE_TRACING
+            thread->pTraceBuffer = new (allocator->Allocate(sizeof(Internal::JobTraceBuffer), alignof(Internal::JobTraceBuffer)))
+                Internal::JobTraceBuffer(desc.TraceBufferCapacity);
+#endif
+
+            if (cpus.Any())
+            {
+                auto& cpu       = cpus[i % cpus.Size()];
+                thread->CpuID   = cpu.ID;
+                thread->GroupID = GetGroupID(cpu, desc.Grouping);
+            }
+
+            m_Workers.Push(thread);
         }
 
-        m_Semaphore.Release(GetWorkerCount());
+        // Workers that aren't running have empty queues, so the victims don't depend on which workers run
+        for (UInt32 i = 0; i < m_WorkerCount; ++i)
+        {
+            auto* thread = m_Workers[i];
+            for (UInt32 j = 0; j < m_WorkerCount; ++j)
+            {
+                if (i == j)
+                {
+                    continue;
+                }
+
+                auto& victims = m_Workers[j]->GroupID == thread->GroupID ? thread->LocalVictims : thread->RemoteVictims;
+                victims.Push(j);
+            }
+        }
+
+        for (UInt32 i = 0; i < m_MinWorkerCount; ++i)
+        {
+            TryStartWorker(i);
+        }
     }
 
     UInt32 JobScheduler::GetWorkerCount() const
@@ -29,9 +114,76 @@ namespace UN::Async
         return m_WorkerCount;
     }
 
+    UInt32 JobScheduler::GetActiveWorkerCount() const
+    {
+        return m_ActiveWorkerCount.load(std::memory_order_relaxed);
+    }
+
+    bool JobScheduler::TryStartWorker(UInt32 id)
+    {
+        auto* thread = m_Workers[id];
+        if (thread->State.load() != JobWorkerState::Stopped)
+        {
+            return false;
+        }
+
+        // Check the exit flag before claiming the slot, so that a stopped scheduler has no Running slots without threads
+        std::lock_guard lk(m_StartMutex);
+        if (m_ShouldExit.load())
+        {
+            return false;
+        }
+
+        auto expected = JobWorkerState::Stopped;
+        if (!thread->State.compare_exchange_strong(expected, JobWorkerState::Running))
+        {
+            return false;
+        }
+
+        m_ActiveWorkerCount.fetch_add(1);
+
+        // The new worker is looking for a job from the start, so that the submitters don't start more workers
+        m_SearchingWorkerCount.fetch_add(1);
+
+        // The previous thread of the slot has already decided to exit
+        if (thread->Thread.joinable())
+        {
+            thread->Thread.join();
+        }
+
+        thread->Thread = std::thread(&JobScheduler::WorkerThreadProcess, this, id);
+        return true;
+    }
+
+    void JobScheduler::StartWorkers(USize jobCount)
+    {
+        // The loads are ordered by the fence in WakeWorker() that the callers execute after queueing the jobs.
+        // A worker that parks or stops concurrently checks the queues after changing these counters.
+        auto idleCount = static_cast<USize>(m_ParkedWorkerCount.load(std::memory_order_relaxed))
+                       + m_SearchingWorkerCount.load(std::memory_order_relaxed);
+        if (idleCount >= jobCount)
+        {
+            return;
+        }
+
+        auto startCount = jobCount - idleCount;
+        for (UInt32 i = 0; i < m_WorkerCount && startCount > 0; ++i)
+        {
+            if (m_ActiveWorkerCount.load(std::memory_order_relaxed) >= m_WorkerCount)
+            {
+                return;
+            }
+
+            if (TryStartWorker(i))
+            {
+                --startCount;
+            }
+        }
+    }
+
     UInt32 JobScheduler::GetWorkerID() const
     {
-        return m_CurrentThreadInfo->WorkerID;
+        return m_CurrentSchedulerID == m_ID ? m_CurrentThreadInfo->WorkerID : static_cast<UInt32>(-1);
     }
 
     void JobScheduler::ScheduleJob(Job* job)
@@ -40,52 +192,417 @@ namespace UN::Async
 
         if (job->Empty())
         {
-            Execute(job);
+            Execute(thread, job);
             return;
         }
         if (thread->IsWorker())
         {
             thread->Queue.Enqueue(job);
-            NotifyWorker();
+        }
+        else
+        {
+            m_GlobalQueue.Enqueue(job);
+        }
+
+        WakeWorker();
+        StartWorkers(1);
+    }
+
+    void JobScheduler::ScheduleJobs(ArraySlice<Job* const> jobs)
+    {
+        auto* thread = GetCurrentThread();
+
+        USize queuedCount = 0;
+        for (auto* job : jobs)
+        {
+            if (job->Empty())
+            {
+                Execute(thread, job);
+                continue;
+            }
+
+            if (thread->IsWorker())
+            {
+                thread->Queue.Enqueue(job);
+            }
+            else
+            {
+                m_GlobalQueue.Enqueue(job);
+            }
+
+            ++queuedCount;
+        }
+
+        // Wake up a worker per job, waking up is almost free when there are no parked workers
+        auto notifyCount = std::min<USize>(queuedCount, m_WorkerCount);
+        for (USize i = 0; i < notifyCount; ++i)
+        {
+            if (!WakeWorker())
+            {
+                break;
+            }
+        }
+
+        if (queuedCount > 0)
+        {
+            StartWorkers(notifyCount);
+        }
+    }
+
+    SchedulerThreadInfo* JobScheduler::GetPinnedThread(UInt32 workerID) const
+    {
+        if (workerID < m_WorkerCount)
+        {
+            return m_Workers[workerID];
+        }
+
+        auto index = workerID - m_WorkerCount;
+        return index < m_ExternalWorkerCount.load(std::memory_order_acquire) ? m_ExternalWorkers[index] : nullptr;
+    }
+
+    void JobScheduler::ScheduleJobOnWorker(Job* job, UInt32 workerID)
+    {
+        auto* target = GetPinnedThread(workerID);
+        UN_Assert(target, "Unknown worker ID");
+
+        // Don't lose the job if the ID is wrong, any worker is better than none
+        if (target == nullptr || job->Empty())
+        {
+            ScheduleJob(job);
+            return;
+        }
+
+        target->GetMailbox().Enqueue(job);
+        if (target->IsExternalWorker)
+        {
+            target->ParkEvent.NotifyOne();
+            return;
+        }
+
+        // Pairs with the fence in TryRetire(): either the worker sees the job or we see it stopped
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (target->State.load(std::memory_order_relaxed) == JobWorkerState::Stopped)
+        {
+            TryStartWorker(workerID);
+        }
+        else
+        {
+            // A parking worker checks its mailbox after PrepareWait(), so only the target is woken up
+            target->ParkEvent.NotifyOne();
+        }
+    }
+
+    UInt32 JobScheduler::RegisterExternalWorker()
+    {
+        auto* thread = GetCurrentThread();
+        UN_Assert(!thread->IsWorker(), "Worker threads can't be registered as external workers");
+
+        std::unique_lock lk(m_ThreadsMutex);
+        if (thread->IsExternalWorker)
+        {
+            return thread->WorkerID;
+        }
+
+        auto index = m_ExternalWorkerCount.load(std::memory_order_relaxed);
+        if (index == MaxExternalWorkerCount)
+        {
+            return static_cast<UInt32>(-1);
+        }
+
+        // Jobs are pinned to external workers from the start, create the mailbox before anyone can see the ID
+        thread->GetMailbox();
+        thread->WorkerID         = m_WorkerCount + index;
+        thread->IsExternalWorker = true;
+        m_ExternalWorkers[index] = thread;
+        m_ExternalWorkerCount.store(index + 1, std::memory_order_release);
+        return thread->WorkerID;
+    }
+
+    USize JobScheduler::PumpMailbox(bool wait)
+    {
+        auto* thread = GetCurrentThread();
+        UN_Assert(thread->IsExternalWorker, "The thread is not registered as an external worker");
+
+        auto& mailbox       = thread->GetMailbox();
+        USize executedCount = 0;
+        while (true)
+        {
+            while (auto* job = mailbox.Dequeue())
+            {
+                Execute(thread, job);
+                ++executedCount;
+            }
+
+            if (executedCount > 0 || !wait)
+            {
+                return executedCount;
+            }
+
+            auto key = thread->ParkEvent.PrepareWait();
+            if (mailbox.Empty())
+            {
+                thread->ParkEvent.Wait(key);
+            }
+            else
+            {
+                thread->ParkEvent.CancelWait();
+            }
+        }
+    }
+
+    void JobScheduler::ScheduleBlockingJob(Job* job)
+    {
+        if (job->Empty())
+        {
+            Execute(GetCurrentThread(), job);
+            return;
+        }
+
+        std::lock_guard lk(m_BlockingMutex);
+        m_BlockingQueue.Enqueue(job);
+        ++m_QueuedBlockingJobCount;
+
+        // Start a new thread only if the idle ones can't take all the queued jobs
+        if (m_QueuedBlockingJobCount > m_IdleBlockingThreadCount && m_BlockingThreadCount < m_MaxBlockingThreadCount)
+        {
+            ++m_BlockingThreadCount;
+            std::thread(&JobScheduler::BlockingThreadProcess, this).detach();
+        }
+        else if (m_IdleBlockingThreadCount > 0)
+        {
+            m_BlockingCondition.notify_one();
+        }
+    }
+
+    UInt32 JobScheduler::GetBlockingThreadCount()
+    {
+        std::lock_guard lk(m_BlockingMutex);
+        return m_BlockingThreadCount;
+    }
+
+    void JobScheduler::BlockingThreadProcess()
+    {
+        // Blocking threads come and go, so they don't register in m_Threads. Each one still needs its own info,
+        // a blocking job can help in SyncWait() and the helpers update their thread info.
+        SchedulerThreadInfo thread;
+        m_CurrentThreadInfo  = &thread;
+        m_CurrentSchedulerID = m_ID;
+        m_IsWorkerThread     = true;
+
+        std::unique_lock lk(m_BlockingMutex);
+        while (true)
+        {
+            if (m_QueuedBlockingJobCount > 0)
+            {
+                --m_QueuedBlockingJobCount;
+                auto* job = m_BlockingQueue.Dequeue();
+                lk.unlock();
+
+                Execute(&thread, job);
+
+                lk.lock();
+                continue;
+            }
+
+            if (m_StopBlockingThreads)
+            {
+                break;
+            }
+
+            ++m_IdleBlockingThreadCount;
+            auto hasWork = m_BlockingCondition.wait_for(lk, m_BlockingThreadIdleTimeout, [this] {
+                return m_QueuedBlockingJobCount > 0 || m_StopBlockingThreads;
+            });
+            --m_IdleBlockingThreadCount;
+
+            if (!hasWork)
+            {
+                break;
+            }
+        }
+
+        // The scheduler can be destroyed as soon as the mutex is unlocked
+        --m_BlockingThreadCount;
+        m_BlockingCondition.notify_all();
+    }
+
+    void JobScheduler::StartTimer(Internal::TimerWheelEntry* pEntry)
+    {
+        UInt64 nextTick;
+        {
+            std::unique_lock lk(m_TimerMutex);
+            if (!m_Timers.Insert(pEntry))
+            {
+                lk.unlock();
+                ScheduleJob(pEntry->pJob);
+                return;
+            }
+
+            nextTick = m_Timers.GetNextTick();
+            m_NextTimerTick.store(nextTick, std::memory_order_release);
+        }
+
+        // If no parked worker waits for a tick this early, wake one up to take over the timed wait
+        if (nextTick < m_TimerWaitTick.load(std::memory_order_acquire))
+        {
+            WakeWorker();
+        }
+
+        // Pairs with the fence in TryRetire(), the last worker doesn't stop while there are timers
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_ActiveWorkerCount.load(std::memory_order_relaxed) == 0)
+        {
+            StartWorkers(1);
+        }
+    }
+
+    bool JobScheduler::CancelTimer(Internal::TimerWheelEntry* pEntry)
+    {
+        std::lock_guard lk(m_TimerMutex);
+        if (!m_Timers.Remove(pEntry))
+        {
+            return false;
+        }
+
+        m_NextTimerTick.store(m_Timers.GetNextTick(), std::memory_order_release);
+        return true;
+    }
+
+    void JobScheduler::ProcessTimers()
+    {
+        auto nextTick = m_NextTimerTick.load(std::memory_order_acquire);
+        if (nextTick == Internal::TimerWheel::NoTick)
+        {
+            return;
+        }
+
+        auto now = JobClock::now();
+        if (now < m_Timers.GetTickTime(nextTick))
+        {
             return;
         }
-        m_GlobalQueue.Enqueue(job);
-        NotifyWorker();
+
+        // If another worker is servicing the timers, there's no need to wait for it
+        std::unique_lock lk(m_TimerMutex, std::try_to_lock);
+        if (!lk.owns_lock())
+        {
+            return;
+        }
+
+        auto* pExpired = m_Timers.Advance(now);
+        m_NextTimerTick.store(m_Timers.GetNextTick(), std::memory_order_release);
+        lk.unlock();
+
+        Job* batch[TimerBatchSize];
+        USize batchSize = 0;
+        while (pExpired)
+        {
+            // A scheduled job can restart its timer and reuse the entry, so read the next one first
+            auto* pNext        = pExpired->pNext;
+            batch[batchSize++] = pExpired->pJob;
+            pExpired           = pNext;
+
+            if (batchSize == TimerBatchSize)
+            {
+                ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+                batchSize = 0;
+            }
+        }
+
+        if (batchSize > 0)
+        {
+            ScheduleJobs(ArraySlice<Job* const>(batch, batchSize));
+        }
     }
 
     JobScheduler::~JobScheduler() noexcept
     {
-        m_ShouldExit.store(true);
-        for (UInt32 i = 0; i < m_WorkerCount; ++i)
+        // Blocking jobs resume their coroutines on the workers, so wait for them first
+        {
+            std::unique_lock lk(m_BlockingMutex);
+            m_StopBlockingThreads = true;
+            m_BlockingCondition.notify_all();
+            m_BlockingCondition.wait(lk, [this] {
+                return m_BlockingThreadCount == 0;
+            });
+        }
+
+        {
+            std::lock_guard lk(m_StartMutex);
+            m_ShouldExit.store(true);
+        }
+
+        for (auto* worker : m_Workers)
         {
-            m_Threads[i]->WaitSemaphore.Release();
-            m_Threads[i]->Thread.join();
+            worker->ParkEvent.NotifyAll();
         }
+
+        for (auto* worker : m_Workers)
+        {
+            if (worker->Thread.joinable())
+            {
+                worker->Thread.join();
+            }
+        }
+
         auto* allocator = SystemAllocator::Get();
-        for (auto t : m_Threads)
+        for (auto* pThreads : { &m_Workers, &m_Threads })
         {
-            t->~SchedulerThreadInfo();
-            allocator->Deallocate(t);
+            for (auto t : *pThreads)
+            {
+#if UN_ASYNC_ENABLE_TRACING
+                if (t->pTraceBuffer)
+                {
+                    t->pTraceBuffer->~JobTraceBuffer();
+                    allocator->Deallocate(t->pTraceBuffer);
+                }
+#endif
+
+                t->~SchedulerThreadInfo();
+                allocator->Deallocate(t);
+            }
         }
     }
 
     void JobScheduler::WorkerThreadProcess(UInt32 id)
     {
-        m_Semaphore.Acquire();
-        m_CurrentThreadInfo = m_Threads[id];
+        m_CurrentThreadInfo              = m_Workers[id];
+        m_CurrentSchedulerID             = m_ID;
+        m_IsWorkerThread                 = true;
+        Internal::CurrentWorkerScheduler = this;
+        if (m_CurrentThreadInfo->CpuID != static_cast<UInt32>(-1) && !PinCurrentThreadToCpu(m_CurrentThreadInfo->CpuID))
+        {
+            // The worker runs wherever the OS puts it, its group is still used to pick the victims
+            m_CurrentThreadInfo->CpuID = static_cast<UInt32>(-1);
+        }
+
         ProcessJobs();
     }
 
-    void JobScheduler::Execute(Job* job)
+    void JobScheduler::Execute(SchedulerThreadInfo* thread, Job* job)
     {
+        UN_JOB_TRACE(thread, JobTraceEventType::Execute, JobTracePhase::Begin, job->GetTraceName());
+
         JobExecutionContext context{};
-        context.WorkerID = m_CurrentThreadInfo->WorkerID;
-        job->ExecuteInternal(context);
+        context.WorkerID = thread->WorkerID;
+        auto executed = job->ExecuteInternal(context);
+
+        UN_JOB_TRACE(thread, JobTraceEventType::Execute, JobTracePhase::End);
+
+        if (thread->IsWorker())
+        {
+            Internal::IncrementCounter(executed ? thread->Counters.ExecutedJobs : thread->Counters.CancelledJobs);
+        }
     }
 
     SchedulerThreadInfo* JobScheduler::GetCurrentThread()
     {
-        if (!m_CurrentThreadInfo)
+        if (m_CurrentSchedulerID == m_ID)
+        {
+            return m_CurrentThreadInfo;
+        }
+
+        SchedulerThreadInfo* result = nullptr;
         {
             std::shared_lock lk(m_ThreadsMutex);
 
@@ -93,131 +610,492 @@ namespace UN::Async
             {
                 if (thread->ThreadID == std::this_thread::get_id())
                 {
-                    m_CurrentThreadInfo = thread;
+                    result = thread;
                 }
             }
         }
 
-        if (!m_CurrentThreadInfo)
+        if (!result)
         {
             std::unique_lock lk(m_ThreadsMutex);
 
-            auto* allocator  = SystemAllocator::Get();
-            auto* thread     = new (allocator->Allocate(sizeof(SchedulerThreadInfo), 16)) SchedulerThreadInfo;
-            thread->ThreadID = std::this_thread::get_id();
-            m_Threads.Push(thread);
-            m_CurrentThreadInfo = thread;
+            auto* allocator = SystemAllocator::Get();
+            result = new (allocator->Allocate(sizeof(SchedulerThreadInfo), alignof(SchedulerThreadInfo)))
+                SchedulerThreadInfo;
+            result->ThreadID = std::this_thread::get_id();
+            m_Threads.Push(result);
         }
 
-        return m_CurrentThreadInfo;
+        // Workers of other schedulers must keep their own thread info. The info cached by other threads
+        // can belong to a destroyed scheduler, so it's safe to replace it.
+        if (!m_IsWorkerThread)
+        {
+            m_CurrentThreadInfo  = result;
+            m_CurrentSchedulerID = m_ID;
+        }
+
+        return result;
     }
 
-    void JobScheduler::NotifyWorker()
+    JobSchedulerStatistics JobScheduler::GetStatistics() const
     {
-        while (m_SleepingWorkerCount.load())
+        JobSchedulerStatistics result;
+        result.Workers.Reserve(m_WorkerCount);
+        for (UInt32 i = 0; i < m_WorkerCount; ++i)
         {
-            for (UInt32 i = 0; i < m_WorkerCount; ++i)
-            {
-                if (m_Threads[i]->IsSleeping.exchange(false))
-                {
-                    --m_SleepingWorkerCount;
-                    m_Threads[i]->WaitSemaphore.Release();
-                }
-            }
+            auto* thread   = m_Workers[i];
+            auto& counters = thread->Counters;
+
+            auto& worker               = result.Workers.Emplace();
+            worker.ExecutedJobs        = counters.ExecutedJobs.load(std::memory_order_relaxed);
+            worker.CancelledJobs       = counters.CancelledJobs.load(std::memory_order_relaxed);
+            worker.StolenJobs          = counters.StolenJobs.load(std::memory_order_relaxed);
+            worker.JobsStolenByOthers  = thread->JobsStolenByOthers.load(std::memory_order_relaxed);
+            worker.SuccessfulSteals    = counters.SuccessfulSteals.load(std::memory_order_relaxed);
+            worker.FailedSteals        = counters.FailedSteals.load(std::memory_order_relaxed);
+            worker.GlobalQueueDequeues = counters.GlobalQueueDequeues.load(std::memory_order_relaxed);
+            worker.ParkCount           = counters.ParkCount.load(std::memory_order_relaxed);
+            worker.QueueDepth          = thread->Queue.Size();
+            worker.ParkedTime          = std::chrono::nanoseconds(counters.ParkedNanoseconds.load(std::memory_order_relaxed));
         }
+
+        return result;
     }
 
-    Job* JobScheduler::TryStealJob(UInt32& victimIndex)
+    void JobScheduler::StartTracing()
     {
-        const auto attempts = m_WorkerCount * 2;
+#if UN_ASYNC_ENABLE_TRACING
+        for (auto* worker : m_Workers)
+        {
+            worker->pTraceBuffer->Restart();
+        }
+
+        m_IsTracing.store(true, std::memory_order_relaxed);
+#endif
+    }
 
-        if (m_WorkerCount <= 1)
+    void JobScheduler::StopTracing()
+    {
+#if UN_ASYNC_ENABLE_TRACING
+        m_IsTracing.store(false, std::memory_order_relaxed);
+#endif
+    }
+
+    JobTrace JobScheduler::CollectTrace() const
+    {
+        JobTrace result;
+#if UN_ASYNC_ENABLE_TRACING
+        result.Workers.Reserve(m_WorkerCount);
+        for (UInt32 i = 0; i < m_WorkerCount; ++i)
         {
-            return nullptr;
+            auto& worker    = result.Workers.Emplace();
+            worker.WorkerID = i;
+            m_Workers[i]->pTraceBuffer->Read(worker.Events);
         }
+#endif
+
+        return result;
+    }
 
+    Job* JobScheduler::TryStealJob(const List<UInt32>& victims)
+    {
+        const auto victimCount = static_cast<UInt32>(victims.Size());
+        const auto attempts    = victimCount * 2;
+
+        auto* current = m_CurrentThreadInfo;
         for (UInt32 i = 0; i < attempts; ++i)
         {
-            Job* job = m_Threads[victimIndex]->Queue.Steal();
+            // Pick a random victim, so that thieves don't pile onto the same victims
+            auto victimIndex = victims[current->Random.Next(victimCount)];
+
+            auto* victim = m_Workers[victimIndex];
+
+            UInt32 stolenCount;
+            Job* job = victim->Queue.StealHalf(current->Queue, stolenCount);
             if (job)
             {
+                Internal::IncrementCounter(current->Counters.SuccessfulSteals);
+                Internal::IncrementCounter(current->Counters.StolenJobs, stolenCount);
+                victim->JobsStolenByOthers.fetch_add(stolenCount, std::memory_order_relaxed);
+                UN_JOB_TRACE(current, JobTraceEventType::Steal, JobTracePhase::Instant, nullptr, stolenCount);
                 return job;
             }
 
-            victimIndex = (victimIndex + 1) % m_WorkerCount;
-            if (victimIndex == m_CurrentThreadInfo->WorkerID)
+            Internal::IncrementCounter(current->Counters.FailedSteals);
+        }
+
+        return nullptr;
+    }
+
+    Job* JobScheduler::TryStealJob()
+    {
+        // Steals from other groups move cache lines across sockets or L3 caches, so try the local group first
+        if (auto* job = TryStealJob(m_CurrentThreadInfo->LocalVictims))
+        {
+            return job;
+        }
+
+        return TryStealJob(m_CurrentThreadInfo->RemoteVictims);
+    }
+
+    Job* JobScheduler::FindJob()
+    {
+        // Pinned jobs go first, nobody else can execute them
+        if (!m_CurrentThreadInfo->IsMailboxEmpty())
+        {
+            if (auto* job = m_CurrentThreadInfo->pMailbox.load(std::memory_order_relaxed)->Dequeue())
             {
-                victimIndex = (victimIndex + 1) % m_WorkerCount;
+                return job;
             }
         }
 
-        return nullptr;
+        if (auto* job = m_CurrentThreadInfo->Queue.SelfSteal())
+        {
+            return job;
+        }
+
+        if (auto* job = m_GlobalQueue.Dequeue())
+        {
+            Internal::IncrementCounter(m_CurrentThreadInfo->Counters.GlobalQueueDequeues);
+            UN_JOB_TRACE(m_CurrentThreadInfo, JobTraceEventType::GlobalQueueDequeue, JobTracePhase::Instant);
+            return job;
+        }
+
+        return TryStealJob();
     }
 
-    void JobScheduler::ProcessJobs()
+    EventCount::Key JobScheduler::PrepareParking()
     {
-        auto shouldExit = [this]() {
-            return m_ShouldExit.load();
-        };
-        UInt32 victimIndex = 0;
-        if (m_CurrentThreadInfo->WorkerID == 0)
+        auto* thread = m_CurrentThreadInfo;
+        auto key     = thread->ParkEvent.PrepareWait();
         {
-            victimIndex = 1;
+            std::lock_guard lk(m_IdleMutex);
+            thread->IsIdle = true;
+            m_IdleWorkers.Push(thread);
         }
 
-        while (true)
+        // Pairs with the fence in WakeWorker(): either the submitter sees the worker parked or the worker sees the job
+        m_ParkedWorkerCount.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return key;
+    }
+
+    bool JobScheduler::FinishParking()
+    {
+        auto* thread = m_CurrentThreadInfo;
+
+        bool isWoken;
         {
-            if (m_CurrentThreadInfo->IsWorker())
+            std::lock_guard lk(m_IdleMutex);
+            isWoken = !thread->IsIdle;
+            if (thread->IsIdle)
             {
-                if (shouldExit())
+                thread->IsIdle = false;
+                for (USize i = 0; i < m_IdleWorkers.Size(); ++i)
                 {
-                    return;
+                    if (m_IdleWorkers[i] == thread)
+                    {
+                        m_IdleWorkers[i] = m_IdleWorkers.Back();
+                        m_IdleWorkers.Pop();
+                        break;
+                    }
                 }
+            }
+        }
 
-                bool shouldSleep = false;
-                if (m_GlobalQueue.Empty())
-                {
-                    NotifyWorker();
+        m_ParkedWorkerCount.fetch_sub(1);
+        return isWoken;
+    }
 
-                    shouldSleep = m_GlobalQueue.Empty();
-                }
+    bool JobScheduler::WakeWorker()
+    {
+        // Pairs with the fence in PrepareParking()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_ParkedWorkerCount.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
 
-                if (shouldSleep)
-                {
-                    ++m_SleepingWorkerCount;
-                    m_CurrentThreadInfo->IsSleeping.store(true);
-                    m_CurrentThreadInfo->WaitSemaphore.Acquire();
+        SchedulerThreadInfo* thread = nullptr;
+        {
+            std::lock_guard lk(m_IdleMutex);
+            if (m_IdleWorkers.Any())
+            {
+                thread         = m_IdleWorkers.Pop();
+                thread->IsIdle = false;
+            }
+        }
 
-                    if (shouldExit())
-                    {
-                        return;
-                    }
+        if (thread == nullptr)
+        {
+            return false;
+        }
+
+        thread->ParkEvent.NotifyOne();
+        return true;
+    }
+
+    bool JobScheduler::Park(EventCount::Key key)
+    {
+        auto& counters  = m_CurrentThreadInfo->Counters;
+        auto& parkEvent = m_CurrentThreadInfo->ParkEvent;
+        Internal::IncrementCounter(counters.ParkCount);
+
+        UN_JOB_TRACE(m_CurrentThreadInfo, JobTraceEventType::Park, JobTracePhase::Begin);
+        auto start = std::chrono::steady_clock::now();
+
+        // Workers above the minimum wait with a timeout, so that they can exit when idle for too long
+        auto canStop                   = m_ActiveWorkerCount.load(std::memory_order_relaxed) > m_MinWorkerCount;
+        JobClock::duration idleTimeout = m_WorkerIdleTimeout;
+
+        // One parked worker waits until the next timer tick, the rest wait only for notifications
+        bool isIdle   = false;
+        auto nextTick = m_NextTimerTick.load(std::memory_order_acquire);
+        auto waitTick = m_TimerWaitTick.load(std::memory_order_acquire);
+        if (nextTick < waitTick && m_TimerWaitTick.compare_exchange_strong(waitTick, nextTick))
+        {
+            auto timerTimeout = m_Timers.GetTickTime(nextTick) - JobClock::now();
+            auto notified     = parkEvent.Wait(key, canStop ? std::min(timerTimeout, idleTimeout) : timerTimeout);
+            isIdle            = canStop && !notified && timerTimeout >= idleTimeout;
+
+            // If woken up by a job, hand the timed wait over to another parked worker
+            auto hasTimers = m_NextTimerTick.load(std::memory_order_acquire) != Internal::TimerWheel::NoTick;
+            if (m_TimerWaitTick.compare_exchange_strong(nextTick, Internal::TimerWheel::NoTick) && notified && hasTimers)
+            {
+                WakeWorker();
+            }
+        }
+        else if (canStop)
+        {
+            isIdle = !parkEvent.Wait(key, idleTimeout);
+        }
+        else
+        {
+            parkEvent.Wait(key);
+        }
+
+        auto parkedTime = std::chrono::steady_clock::now() - start;
+        UN_JOB_TRACE(m_CurrentThreadInfo, JobTraceEventType::Park, JobTracePhase::End);
+
+        Internal::IncrementCounter(
+            counters.ParkedNanoseconds,
+            static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(parkedTime).count()));
+
+        return isIdle;
+    }
+
+    bool JobScheduler::TryRetire()
+    {
+        auto* thread = m_CurrentThreadInfo;
+
+        auto count = m_ActiveWorkerCount.load();
+        do
+        {
+            if (count <= m_MinWorkerCount)
+            {
+                return false;
+            }
+        }
+        while (!m_ActiveWorkerCount.compare_exchange_weak(count, count - 1));
+
+        thread->State.store(JobWorkerState::Stopped);
+
+        // Pairs with the fences of the submitters: either they see the worker stopped or we see their jobs.
+        // The worker's own queue is empty, nobody else pushes to it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto hasTimers = m_NextTimerTick.load(std::memory_order_relaxed) != Internal::TimerWheel::NoTick;
+        if (thread->IsMailboxEmpty() && m_GlobalQueue.Empty() && !(count == 1 && hasTimers))
+        {
+            return true;
+        }
+
+        // Keep running, unless a submitter has already restarted the slot and will join this thread
+        auto expected = JobWorkerState::Stopped;
+        if (!thread->State.compare_exchange_strong(expected, JobWorkerState::Running))
+        {
+            return true;
+        }
+
+        m_ActiveWorkerCount.fetch_add(1);
+        return false;
+    }
+
+    Job* JobScheduler::FindJobForHelper(SchedulerThreadInfo* thread)
+    {
+        if (thread->IsWorker())
+        {
+            return FindJob();
+        }
+
+        // Nobody else runs the jobs pinned to an external worker, it would wait for itself otherwise
+        if (thread->IsExternalWorker && !thread->IsMailboxEmpty())
+        {
+            if (auto* job = thread->pMailbox.load(std::memory_order_relaxed)->Dequeue())
+            {
+                return job;
+            }
+        }
+
+        if (auto* job = m_GlobalQueue.Dequeue())
+        {
+            return job;
+        }
+
+        // A non-worker has no queue to steal half of the jobs to, so it steals them one by one
+        for (UInt32 i = 0; i < m_WorkerCount; ++i)
+        {
+            auto* victim = m_Workers[thread->Random.Next(m_WorkerCount)];
+            if (auto* job = victim->Queue.Steal())
+            {
+                victim->JobsStolenByOthers.fetch_add(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobScheduler::HelpUntil(const Internal::ManualResetEvent& event)
+    {
+        auto* thread = GetCurrentThread();
+        while (!event.IsSet())
+        {
+            ProcessTimers();
+            Job* job = FindJobForHelper(thread);
+
+            Internal::SpinLockWait wait;
+            for (UInt32 i = 0; i < WorkerSpinCount && job == nullptr && !event.IsSet(); ++i)
+            {
+                wait.Wait();
+                job = FindJobForHelper(thread);
+            }
+
+            if (job)
+            {
+                Execute(thread, job);
+                continue;
+            }
+
+            // Park on the thread's own event, the thread that sets the event wakes up only this thread.
+            // Workers park like idle ones, non-workers can't service the timers and must not take wake-ups for jobs.
+            auto key = thread->IsWorker() ? PrepareParking() : thread->ParkEvent.PrepareWait();
+
+            job = event.IsSet() ? nullptr : FindJobForHelper(thread);
+            if (job == nullptr && !event.IsSet())
+            {
+                // Only the worker's own thread info can be used to service the timers
+                if (thread->IsWorker())
+                {
+                    Park(key);
+                    FinishParking();
+                }
+                else
+                {
+                    thread->ParkEvent.Wait(key);
                 }
             }
+            else
+            {
+                if (thread->IsWorker())
+                {
+                    FinishParking();
+                }
 
-            Job* job = m_GlobalQueue.Dequeue();
-            if (job == nullptr)
+                thread->ParkEvent.CancelWait();
+            }
+
+            if (job)
             {
-                job = m_CurrentThreadInfo->Queue.SelfSteal();
+                Execute(thread, job);
             }
+        }
+    }
 
-            while (true)
+    SchedulerThreadInfo* JobScheduler::GetCurrentThreadInfo()
+    {
+        return GetCurrentThread();
+    }
+
+    void JobScheduler::WakeHelper(SchedulerThreadInfo* pThread)
+    {
+        // The helper checks its event after PrepareWait(), so either it sees the event set or it's woken up
+        pThread->ParkEvent.NotifyOne();
+    }
+
+    void JobScheduler::ProcessJobs()
+    {
+        // A worker is started to take a job, so it's counted as searching from the start, see TryStartWorker()
+        bool isSearching = true;
+        while (!m_ShouldExit.load())
+        {
+            ProcessTimers();
+            Job* job = FindJob();
+            if (job == nullptr && !isSearching)
+            {
+                isSearching = true;
+                m_SearchingWorkerCount.fetch_add(1);
+            }
+
+            // New jobs often arrive shortly after the queues become empty, so spin for a while before parking.
+            Internal::SpinLockWait wait;
+            for (UInt32 i = 0; i < WorkerSpinCount && job == nullptr; ++i)
             {
-                while (job)
+                wait.Wait();
+                job = FindJob();
+            }
+
+            if (job == nullptr)
+            {
+                auto key = PrepareParking();
+
+                ProcessTimers();
+                job = FindJob();
+                if (job == nullptr && !m_ShouldExit.load())
                 {
-                    Execute(job);
-                    job = m_CurrentThreadInfo->Queue.SelfSteal();
-                    if (job)
+                    // The worker is counted as parked from now on
+                    isSearching = false;
+                    m_SearchingWorkerCount.fetch_sub(1);
+
+                    // A worker woken up for a job doesn't retire, even if its wait has just timed out
+                    auto isIdle  = Park(key);
+                    auto isWoken = FinishParking();
+                    if (isIdle && !isWoken && TryRetire())
                     {
-                        NotifyWorker();
+                        return;
                     }
+
+                    continue;
                 }
-                job = TryStealJob(victimIndex);
-                if (!job)
+
+                FinishParking();
+                m_CurrentThreadInfo->ParkEvent.CancelWait();
+            }
+
+            // If the last searching worker found a job and there are more, another worker has to look for them
+            if (isSearching)
+            {
+                isSearching = false;
+                if (m_SearchingWorkerCount.fetch_sub(1) == 1
+                    && (!m_GlobalQueue.Empty() || m_CurrentThreadInfo->Queue.Size() > 0))
                 {
-                    break;
+                    WakeWorker();
+                    StartWorkers(1);
                 }
             }
+
+            while (job)
+            {
+                Execute(m_CurrentThreadInfo, job);
+
+                // Busy workers service the timers too, otherwise the timers would wait until a worker is idle
+                ProcessTimers();
+                job = FindJob();
+            }
+        }
+
+        if (isSearching)
+        {
+            m_SearchingWorkerCount.fetch_sub(1);
         }
     }
 } // namespace UN::Async
@@ -1,20 +1,39 @@
 #pragma once
 #include <UnAsync/Jobs/IJobScheduler.h>
 #include <UnAsync/Jobs/Job.h>
-#include <UnAsync/Parallel/Semaphore.h>
+#include <UnAsync/Jobs/JobTrace.h>
+#include <UnAsync/Jobs/TimerWheel.h>
+#include <UnAsync/Parallel/ConcurrentQueue.h>
+#include <UnAsync/Parallel/CpuTopology.h>
+#include <UnAsync/Parallel/EventCount.h>
+#include <UnAsync/Parallel/SpinMutex.h>
+#include <UnAsync/Parallel/WorkStealingDeque.h>
 #include <UnTL/Containers/List.h>
-#include <deque>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
 
 namespace UN::Async
 {
+    namespace Internal
+    {
+        //! \return Index of the highest priority level set in a mask of non-empty levels.
+        UN_FINLINE USize HighestPriorityIndex(UInt32 mask)
+        {
+            return static_cast<USize>(std::bit_width(mask) - 1);
+        }
+    } // namespace Internal
+
+    //! \brief Queue for jobs submitted from non-worker threads: one lock-free FIFO per job priority.
+    //!
+    //! Any thread can enqueue and dequeue jobs concurrently. Checking for emptiness doesn't take locks
+    //! and doesn't execute atomic read-modify-write operations, so idle workers can poll it cheaply.
     class JobGlobalQueue
     {
-        using DequeAllocator = StdHeapAllocator<Job*>;
-        std::deque<Job*, DequeAllocator> m_Deque;
-        std::mutex m_Mutex;
+        ConcurrentQueue<Job*> m_Queues[JobPriorityCount];
 
     public:
         inline bool Empty();
@@ -24,100 +43,265 @@ namespace UN::Async
 
     bool JobGlobalQueue::Empty()
     {
-        std::unique_lock lk(m_Mutex);
-        return m_Deque.empty();
+        for (auto& queue : m_Queues)
+        {
+            if (!queue.Empty())
+            {
+                return false;
+            }
+        }
+
+        return true;
     }
 
     void JobGlobalQueue::Enqueue(Job* job)
     {
-        std::unique_lock lk(m_Mutex);
-        constexpr auto compare = [](Job* lhs, Job* rhs) {
-            return lhs->GetPriority() > rhs->GetPriority();
-        };
-
-        auto it = std::lower_bound(m_Deque.begin(), m_Deque.end(), job, compare);
-        m_Deque.insert(it, job);
+        m_Queues[static_cast<USize>(job->GetPriority())].Enqueue(job);
     }
 
     Job* JobGlobalQueue::Dequeue()
     {
-        std::unique_lock lk(m_Mutex);
-        if (!m_Deque.empty())
+        for (USize i = JobPriorityCount; i > 0; --i)
         {
-            auto* t = m_Deque.front();
-            m_Deque.pop_front();
-            return t;
+            auto& queue = m_Queues[i - 1];
+            if (queue.Empty())
+            {
+                continue;
+            }
+
+            if (auto* job = queue.Dequeue())
+            {
+                return job;
+            }
         }
+
         return nullptr;
     }
 
+    //! \brief Queue of a worker thread: one lock-free work-stealing deque per job priority.
+    //!
+    //! Only the owner worker can enqueue jobs and steal them from itself, other workers can only steal.
+    //! The owner keeps a mask of non-empty priority levels, so that neither the owner nor the thieves have
+    //! to look into empty deques. The mask is only written by the owner, thieves use it as a hint.
     class JobWorkerQueue
     {
-        using DequeAllocator = StdHeapAllocator<Job*>;
-        std::deque<Job*, DequeAllocator> m_Deque;
-        std::mutex m_Mutex;
-
-        inline Job* GetFrontNoLock();
+        WorkStealingDeque<Job*> m_Deques[JobPriorityCount];
+        std::atomic<UInt32> m_NonEmptyMask{ 0 };
 
     public:
+        //! \brief Maximum number of jobs a thief can move to its own queue in one StealHalf() call.
+        inline static constexpr USize MaxStealBatchSize = 32;
+
         inline void Enqueue(Job* job);
         inline Job* SelfSteal();
         inline Job* Steal();
+
+        //! \return Approximate number of jobs in the queue, can be called from any thread.
+        [[nodiscard]] inline USize Size() const noexcept;
+
+        //! \brief Steal up to a half of the jobs with the highest available priority.
+        //!
+        //! The first stolen job is returned, the rest are moved to the destination queue.
+        //! Must be called by the owner of the destination queue.
+        //!
+        //! \param destination - The thief's own queue.
+        //! \param [out] stolenCount - Total number of stolen jobs.
+        //!
+        //! \return The first stolen job or nullptr if nothing was stolen.
+        inline Job* StealHalf(JobWorkerQueue& destination, UInt32& stolenCount);
     };
 
-    Job* JobWorkerQueue::GetFrontNoLock()
+    void JobWorkerQueue::Enqueue(Job* job)
     {
-        if (!m_Deque.empty())
+        auto priority = static_cast<USize>(job->GetPriority());
+        m_Deques[priority].Push(job);
+
+        auto mask = m_NonEmptyMask.load(std::memory_order_relaxed);
+        if ((mask & UN_BIT(priority)) == 0)
         {
-            auto* front = m_Deque.front();
-            m_Deque.pop_front();
-            return front;
+            m_NonEmptyMask.store(mask | UN_BIT(priority), std::memory_order_release);
+        }
+    }
+
+    Job* JobWorkerQueue::SelfSteal()
+    {
+        auto mask = m_NonEmptyMask.load(std::memory_order_relaxed);
+        while (mask)
+        {
+            auto priority = Internal::HighestPriorityIndex(mask);
+            if (auto* job = m_Deques[priority].Pop())
+            {
+                return job;
+            }
+
+            mask &= ~UN_BIT(priority);
+            m_NonEmptyMask.store(mask, std::memory_order_relaxed);
         }
 
         return nullptr;
     }
 
-    void JobWorkerQueue::Enqueue(Job* job)
+    Job* JobWorkerQueue::Steal()
     {
-        std::unique_lock lk(m_Mutex);
-        constexpr auto compare = [](Job* lhs, Job* rhs) {
-            return lhs->GetPriority() > rhs->GetPriority();
-        };
+        auto mask = m_NonEmptyMask.load(std::memory_order_acquire);
+        while (mask)
+        {
+            auto priority = Internal::HighestPriorityIndex(mask);
+            if (auto* job = m_Deques[priority].Steal())
+            {
+                return job;
+            }
 
-        auto it = std::lower_bound(m_Deque.begin(), m_Deque.end(), job, compare);
-        m_Deque.insert(it, job);
+            mask &= ~UN_BIT(priority);
+        }
+
+        return nullptr;
     }
 
-    Job* JobWorkerQueue::SelfSteal()
+    USize JobWorkerQueue::Size() const noexcept
     {
-        std::unique_lock lk(m_Mutex);
-        return GetFrontNoLock();
+        USize result = 0;
+        for (auto& deque : m_Deques)
+        {
+            result += deque.Size();
+        }
+
+        return result;
     }
 
-    Job* JobWorkerQueue::Steal()
+    Job* JobWorkerQueue::StealHalf(JobWorkerQueue& destination, UInt32& stolenCount)
+    {
+        stolenCount = 0;
+
+        auto mask = m_NonEmptyMask.load(std::memory_order_acquire);
+        while (mask)
+        {
+            auto priority = Internal::HighestPriorityIndex(mask);
+            auto& deque   = m_Deques[priority];
+            if (auto* job = deque.Steal())
+            {
+                stolenCount = 1;
+
+                auto batchSize = std::min(deque.Size() / 2, MaxStealBatchSize);
+                for (USize i = 0; i < batchSize; ++i)
+                {
+                    auto* extra = deque.Steal();
+                    if (extra == nullptr)
+                    {
+                        break;
+                    }
+
+                    destination.Enqueue(extra);
+                    ++stolenCount;
+                }
+
+                return job;
+            }
+
+            mask &= ~UN_BIT(priority);
+        }
+
+        return nullptr;
+    }
+
+    namespace Internal
     {
-        auto pauseCount = 1;
-        for (Int32 i = 0; i < 16; ++i)
+        //! \brief A fast xorshift pseudo-random number generator, not thread-safe.
+        class FastRandom final
         {
-            if (m_Mutex.try_lock())
+            UInt32 m_State;
+
+        public:
+            inline explicit FastRandom(UInt32 seed = 1) noexcept
+                : m_State(seed ? seed : 1)
             {
-                auto* front = GetFrontNoLock();
-                m_Mutex.unlock();
-                return front;
             }
-            if (pauseCount > 32)
+
+            UN_FINLINE UInt32 Next() noexcept
             {
-                std::this_thread::yield();
-                continue;
+                m_State ^= m_State << 13;
+                m_State ^= m_State >> 17;
+                m_State ^= m_State << 5;
+                return m_State;
             }
-            for (Int32 j = 0; j < pauseCount; ++j)
+
+            //! \return A pseudo-random number in range [0, bound).
+            UN_FINLINE UInt32 Next(UInt32 bound) noexcept
             {
-                _mm_pause();
+                return static_cast<UInt32>((static_cast<UInt64>(Next()) * bound) >> 32);
             }
-            pauseCount <<= 1;
+        };
+
+        //! \brief Increment a counter that is written by one thread and read by others without an RMW operation.
+        UN_FINLINE void IncrementCounter(std::atomic<UInt64>& counter, UInt64 value = 1) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
         }
-        return nullptr;
-    }
+
+        //! \brief Counters of a worker thread, written only by the worker itself.
+        //!
+        //! The counters are kept on their own cache line, so that updating them doesn't slow down the thieves.
+        struct alignas(CacheLineSize) JobWorkerCounters
+        {
+            std::atomic<UInt64> ExecutedJobs{ 0 };
+            std::atomic<UInt64> CancelledJobs{ 0 };
+            std::atomic<UInt64> StolenJobs{ 0 };
+            std::atomic<UInt64> SuccessfulSteals{ 0 };
+            std::atomic<UInt64> FailedSteals{ 0 };
+            std::atomic<UInt64> GlobalQueueDequeues{ 0 };
+            std::atomic<UInt64> ParkCount{ 0 };
+            std::atomic<UInt64> ParkedNanoseconds{ 0 };
+        };
+    } // namespace Internal
+
+    //! \brief Defines how workers are grouped for work stealing.
+    enum class JobWorkerGrouping : UInt8
+    {
+        None,    //!< All workers are equidistant.
+        L3Cache, //!< Workers pinned to processors that share an L3 cache form a group.
+        NumaNode //!< Workers pinned to processors of the same NUMA node form a group.
+    };
+
+    class JobSchedulerDesc
+    {
+    public:
+        //! \brief Maximum number of worker threads, zero means one worker per logical processor.
+        //!
+        //! Workers are started on demand: when a job is submitted and no worker is idle or looking for jobs.
+        UInt32 WorkerCount = 0;
+
+        //! \brief Number of workers started by the constructor, idle workers never exit below this number.
+        UInt32 MinWorkerCount = 0;
+
+        //! \brief Time after which an idle worker exits, unless there are only MinWorkerCount workers left.
+        std::chrono::milliseconds WorkerIdleTimeout = std::chrono::seconds(10);
+
+        //! \brief Pin each worker thread to a logical processor.
+        bool PinWorkers = false;
+
+        //! \brief Workers steal from their own group before stealing from remote groups, requires PinWorkers.
+        JobWorkerGrouping Grouping = JobWorkerGrouping::L3Cache;
+
+        //! \brief Number of trace events each worker keeps, must be a power of two.
+        //!
+        //! Only used when tracing is compiled in (UN_ASYNC_ENABLE_TRACING is set).
+        USize TraceBufferCapacity = 65536;
+
+        //! \brief Maximum number of threads that execute blocking jobs, see Job::RunBlocking().
+        //!
+        //! The threads are created on demand, jobs submitted when all of them are busy wait in a queue.
+        UInt32 MaxBlockingThreadCount = 64;
+
+        //! \brief Time after which an idle blocking thread exits.
+        std::chrono::milliseconds BlockingThreadIdleTimeout = std::chrono::seconds(10);
+    };
+
+    //! \brief State of a worker thread slot.
+    enum class JobWorkerState : UInt32
+    {
+        Stopped, //!< No thread runs for the slot, or its thread is exiting.
+        Running  //!< A thread was started for the slot and didn't decide to exit yet.
+    };
 
     struct SchedulerThreadInfo
     {
@@ -125,45 +309,265 @@ namespace UN::Async
         JobWorkerQueue Queue;
         UInt32 WorkerID = static_cast<UInt32>(-1);
         std::thread::id ThreadID;
-        Semaphore WaitSemaphore;
-        std::atomic_bool IsSleeping;
+        Internal::FastRandom Random;
+
+        UInt32 CpuID   = static_cast<UInt32>(-1);
+        UInt32 GroupID = 0;
+        List<UInt32> LocalVictims;
+        List<UInt32> RemoteVictims;
+
+        Internal::JobWorkerCounters Counters;
+
+#if UN_ASYNC_ENABLE_TRACING
+        Internal::JobTraceBuffer* pTraceBuffer = nullptr;
+#endif
+
+        //! \brief Number of jobs stolen from this worker, incremented by thieves.
+        alignas(Internal::CacheLineSize) std::atomic<UInt64> JobsStolenByOthers{ 0 };
+
+        //! \brief Jobs pinned to this thread, only the owner dequeues them and thieves never look into it.
+        //!
+        //! Created on the first pinned job, most threads never get one and a queue preallocates a whole segment.
+        std::atomic<ConcurrentQueue<Job*>*> pMailbox{ nullptr };
+
+        //! \brief The thread parks on its own event, so that it can be woken up without waking up other threads.
+        EventCount ParkEvent;
+
+        //! \brief Set while a parked worker is in the idle list of the scheduler, protected by its mutex.
+        bool IsIdle = false;
+
+        //! \brief The thread is not a worker, but was registered with JobScheduler::RegisterExternalWorker().
+        bool IsExternalWorker = false;
+
+        //! \brief Only used by the workers: a worker is started by the thread that changes it from Stopped to Running.
+        std::atomic<JobWorkerState> State{ JobWorkerState::Stopped };
+
+        inline SchedulerThreadInfo() = default;
+        inline ~SchedulerThreadInfo();
+
+        SchedulerThreadInfo(const SchedulerThreadInfo&)            = delete;
+        SchedulerThreadInfo& operator=(const SchedulerThreadInfo&) = delete;
 
         [[nodiscard]] inline bool IsWorker() const noexcept
         {
-            return WorkerID != static_cast<UInt32>(-1);
+            return WorkerID != static_cast<UInt32>(-1) && !IsExternalWorker;
+        }
+
+        //! \return The mailbox of the thread, created if it doesn't exist yet. Can be called from any thread.
+        inline ConcurrentQueue<Job*>& GetMailbox();
+
+        //! \return True if no jobs are pinned to the thread.
+        [[nodiscard]] inline bool IsMailboxEmpty() const noexcept
+        {
+            auto* pQueue = pMailbox.load(std::memory_order_acquire);
+            return pQueue == nullptr || pQueue->Empty();
         }
     };
 
+    SchedulerThreadInfo::~SchedulerThreadInfo()
+    {
+        if (auto* pQueue = pMailbox.load(std::memory_order_relaxed))
+        {
+            pQueue->~ConcurrentQueue();
+            SystemAllocator::Get()->Deallocate(pQueue);
+        }
+    }
+
+    ConcurrentQueue<Job*>& SchedulerThreadInfo::GetMailbox()
+    {
+        if (auto* pQueue = pMailbox.load(std::memory_order_acquire))
+        {
+            return *pQueue;
+        }
+
+        auto* allocator = SystemAllocator::Get();
+        auto* pQueue    = new (allocator->Allocate(sizeof(ConcurrentQueue<Job*>), alignof(ConcurrentQueue<Job*>)))
+            ConcurrentQueue<Job*>;
+
+        // Another thread can pin a job at the same time, only one of the queues is kept
+        ConcurrentQueue<Job*>* pExpected = nullptr;
+        if (pMailbox.compare_exchange_strong(pExpected, pQueue, std::memory_order_acq_rel))
+        {
+            return *pQueue;
+        }
+
+        pQueue->~ConcurrentQueue();
+        allocator->Deallocate(pQueue);
+        return *pExpected;
+    }
+
     class JobScheduler final : public Object<IJobScheduler>
     {
         const UInt32 m_WorkerCount;
+        const UInt32 m_MinWorkerCount;
+        const std::chrono::milliseconds m_WorkerIdleTimeout;
+
+        //! \brief A slot for every possible worker, created by the constructor and never resized.
+        List<SchedulerThreadInfo*> m_Workers;
+
+        //! \brief Non-worker threads that submitted jobs, protected by m_ThreadsMutex.
         List<SchedulerThreadInfo*> m_Threads;
-        std::shared_mutex m_ThreadsMutex;
+        mutable std::shared_mutex m_ThreadsMutex;
         JobGlobalQueue m_GlobalQueue;
 
-        Semaphore m_Semaphore;
-        std::atomic<Int32> m_SleepingWorkerCount;
+        //! \brief Parked workers that can be woken up for new jobs, protected by m_IdleMutex.
+        //!
+        //! The most recently parked worker is woken up first, its caches are still warm.
+        List<SchedulerThreadInfo*> m_IdleWorkers;
+        SpinMutex m_IdleMutex;
+
+        //! \brief Number of workers between PrepareParking() and FinishParking(), woken up or not.
+        std::atomic<UInt32> m_ParkedWorkerCount{ 0 };
+
         std::atomic_bool m_ShouldExit;
 
+        //! \brief Number of slots in Running state.
+        std::atomic<UInt32> m_ActiveWorkerCount{ 0 };
+
+        //! \brief Number of workers that are looking for jobs, i.e. spinning before they park.
+        //!
+        //! New workers are started only when no worker is parked or searching.
+        std::atomic<UInt32> m_SearchingWorkerCount{ 0 };
+
+        //! \brief Serializes starting the threads and stopping the scheduler.
+        std::mutex m_StartMutex;
+
+        //! \brief Unique ID of the scheduler, never reused by other scheduler instances.
+        const UInt64 m_ID;
+
         static thread_local SchedulerThreadInfo* m_CurrentThreadInfo;
-        inline static constexpr UInt32 MaxThreadCount = 32;
+        static thread_local UInt64 m_CurrentSchedulerID;
+        static thread_local bool m_IsWorkerThread;
+
+    public:
+        //! \brief Maximum number of threads that can be registered with RegisterExternalWorker().
+        inline static constexpr UInt32 MaxExternalWorkerCount = 16;
+
+    private:
+        SchedulerThreadInfo* m_ExternalWorkers[MaxExternalWorkerCount] = {};
+        std::atomic<UInt32> m_ExternalWorkerCount{ 0 };
+
+        //! \brief Number of attempts to find a job before an idle worker parks.
+        inline static constexpr UInt32 WorkerSpinCount = 16;
+
+        SpinMutex m_TimerMutex;
+        Internal::TimerWheel m_Timers;
+
+        //! \brief The next tick at which the timers have work to do, read by workers without the lock.
+        std::atomic<UInt64> m_NextTimerTick{ Internal::TimerWheel::NoTick };
+
+        //! \brief The tick until which a parked worker waits to service the timers.
+        //!
+        //! Only one parked worker waits with a timeout, the rest wait for notifications.
+        std::atomic<UInt64> m_TimerWaitTick{ Internal::TimerWheel::NoTick };
+
+        const UInt32 m_MaxBlockingThreadCount;
+        const std::chrono::milliseconds m_BlockingThreadIdleTimeout;
+
+        ConcurrentQueue<Job*> m_BlockingQueue;
+        std::mutex m_BlockingMutex;
+        std::condition_variable m_BlockingCondition;
+        UInt32 m_BlockingThreadCount     = 0;     //!< Protected by m_BlockingMutex.
+        UInt32 m_IdleBlockingThreadCount = 0;     //!< Protected by m_BlockingMutex.
+        UInt32 m_QueuedBlockingJobCount  = 0;     //!< Protected by m_BlockingMutex.
+        bool m_StopBlockingThreads       = false; //!< Protected by m_BlockingMutex.
 
-        void NotifyWorker();
         void WorkerThreadProcess(UInt32 id);
+        void BlockingThreadProcess();
         void ProcessJobs();
-        void Execute(Job* job);
+        void Execute(SchedulerThreadInfo* thread, Job* job);
+        void ProcessTimers();
+        EventCount::Key PrepareParking();
+        bool FinishParking();
+        bool WakeWorker();
+        bool Park(EventCount::Key key);
+        bool TryStartWorker(UInt32 id);
+        void StartWorkers(USize jobCount);
+        bool TryRetire();
         SchedulerThreadInfo* GetCurrentThread();
-        Job* TryStealJob(UInt32& victimIndex);
+        SchedulerThreadInfo* GetPinnedThread(UInt32 workerID) const;
+#if UN_ASYNC_ENABLE_TRACING
+        std::atomic_bool m_IsTracing{ false };
+
+        UN_FINLINE void Trace(SchedulerThreadInfo* thread, JobTraceEventType type, JobTracePhase phase,
+                              const char* name = nullptr, UInt32 value = 0) noexcept
+        {
+            if (thread->pTraceBuffer && m_IsTracing.load(std::memory_order_relaxed))
+            {
+                thread->pTraceBuffer->Write({ Internal::GetTraceTimestamp(), name, value, type, phase });
+            }
+        }
+#endif
+
+        Job* TryStealJob(const List<UInt32>& victims);
+        Job* TryStealJob();
+        Job* FindJob();
+        Job* FindJobForHelper(SchedulerThreadInfo* thread);
 
     public:
         UN_RTTI_Class(JobScheduler, "6754DA31-46FA-4661-A46E-2787E6D9FD29");
 
         explicit JobScheduler(UInt32 workerCount);
+        explicit JobScheduler(const JobSchedulerDesc& desc);
         ~JobScheduler() noexcept override;
 
         [[nodiscard]] UInt32 GetWorkerCount() const override;
         [[nodiscard]] UInt32 GetWorkerID() const override;
 
         void ScheduleJob(Job* job) override;
+        void ScheduleJobs(ArraySlice<Job* const> jobs) override;
+        void ScheduleJobOnWorker(Job* job, UInt32 workerID) override;
+        void ScheduleBlockingJob(Job* job) override;
+
+        void StartTimer(Internal::TimerWheelEntry* pEntry) override;
+        bool CancelTimer(Internal::TimerWheelEntry* pEntry) override;
+
+        void HelpUntil(const Internal::ManualResetEvent& event) override;
+        SchedulerThreadInfo* GetCurrentThreadInfo() override;
+        void WakeHelper(SchedulerThreadInfo* pThread) override;
+
+        [[nodiscard]] JobSchedulerStatistics GetStatistics() const override;
+
+        //! \brief Register the calling thread as an external worker, e.g. the main thread of an application.
+        //!
+        //! An external worker doesn't execute the scheduler's regular jobs, it only executes the jobs pinned
+        //! to it with ScheduleJobOnWorker() or SwitchToWorker() when it calls PumpMailbox(). Registering
+        //! the same thread again returns the same ID.
+        //!
+        //! \return The worker ID of the calling thread, always greater than or equal to GetWorkerCount(),
+        //!         or static_cast<UInt32>(-1) if MaxExternalWorkerCount threads are already registered.
+        UInt32 RegisterExternalWorker();
+
+        //! \brief Execute the jobs pinned to the calling external worker until its mailbox is empty.
+        //!
+        //! Must be called from a thread registered with RegisterExternalWorker().
+        //!
+        //! \param wait - If true and the mailbox is empty, block until a job is pinned to the thread.
+        //!
+        //! \return Number of executed jobs.
+        USize PumpMailbox(bool wait = false);
+
+        //! \return Number of workers that are currently running, at most GetWorkerCount().
+        [[nodiscard]] UInt32 GetActiveWorkerCount() const;
+
+        //! \return Number of threads that currently exist to execute blocking jobs.
+        [[nodiscard]] UInt32 GetBlockingThreadCount();
+
+        //! \brief Start recording trace events, the events recorded before are discarded.
+        //!
+        //! Tracing is compiled in only when UN_ASYNC_ENABLE_TRACING is set, otherwise this function does nothing.
+        //! When tracing is compiled in, but not started, the workers only check a flag before each event.
+        void StartTracing();
+
+        //! \brief Stop recording trace events, the recorded events are kept until the next StartTracing().
+        void StopTracing();
+
+        //! \brief Copy the trace events recorded since the last StartTracing().
+        //!
+        //! Can be called while tracing, but the oldest events can be lost if the workers overwrite them
+        //! during the copy. Use WriteChromeTrace() to save the result.
+        //!
+        //! \return The recorded events of every worker, empty if tracing is compiled out.
+        [[nodiscard]] JobTrace CollectTrace() const;
     };
 } // namespace UN::Async
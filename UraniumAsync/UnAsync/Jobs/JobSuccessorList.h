@@ -0,0 +1,110 @@
+#pragma once
+#include <UnAsync/Parallel/SmallObjectAllocator.h>
+#include <utility>
+
+namespace UN::Async
+{
+    class Job;
+
+    namespace Internal
+    {
+        //! \brief A chunk of successors allocated from the small object pool.
+        struct JobSuccessorChunk final
+        {
+            //! \brief Number of successors in one chunk, so that a chunk fits in a 128-byte pool block.
+            inline static constexpr USize Capacity = 12;
+
+            JobSuccessorChunk* pNext;
+            USize Count;
+            Job* Successors[Capacity];
+        };
+
+        //! \brief List of jobs that depend on a job.
+        //!
+        //! The first successor is stored inline, so a job with one successor doesn't allocate memory. The rest are
+        //! stored in chunks allocated from the small object pool. The list is not thread-safe: successors must be added
+        //! before the job is scheduled.
+        class JobSuccessorList final
+        {
+            Job* m_pFirst                = nullptr;
+            JobSuccessorChunk* m_pChunks = nullptr;
+
+        public:
+            inline JobSuccessorList() noexcept = default;
+
+            inline JobSuccessorList(JobSuccessorList&& other) noexcept
+                : m_pFirst(std::exchange(other.m_pFirst, nullptr))
+                , m_pChunks(std::exchange(other.m_pChunks, nullptr))
+            {
+            }
+
+            inline JobSuccessorList& operator=(JobSuccessorList&& other) noexcept
+            {
+                Clear();
+                m_pFirst  = std::exchange(other.m_pFirst, nullptr);
+                m_pChunks = std::exchange(other.m_pChunks, nullptr);
+                return *this;
+            }
+
+            JobSuccessorList(const JobSuccessorList&)            = delete;
+            JobSuccessorList& operator=(const JobSuccessorList&) = delete;
+
+            inline ~JobSuccessorList()
+            {
+                Clear();
+            }
+
+            inline void Add(Job* pJob)
+            {
+                if (m_pFirst == nullptr)
+                {
+                    m_pFirst = pJob;
+                    return;
+                }
+
+                if (m_pChunks == nullptr || m_pChunks->Count == JobSuccessorChunk::Capacity)
+                {
+                    auto* pChunk  = static_cast<JobSuccessorChunk*>(SmallObjectAllocator::Allocate(sizeof(JobSuccessorChunk)));
+                    pChunk->pNext = m_pChunks;
+                    pChunk->Count = 0;
+                    m_pChunks     = pChunk;
+                }
+
+                m_pChunks->Successors[m_pChunks->Count++] = pJob;
+            }
+
+            template<class TFunc>
+            inline void ForEach(TFunc&& function) const
+            {
+                if (m_pFirst == nullptr)
+                {
+                    return;
+                }
+
+                function(m_pFirst);
+                for (auto* pChunk = m_pChunks; pChunk; pChunk = pChunk->pNext)
+                {
+                    for (USize i = 0; i < pChunk->Count; ++i)
+                    {
+                        function(pChunk->Successors[i]);
+                    }
+                }
+            }
+
+            inline void Clear() noexcept
+            {
+                while (m_pChunks)
+                {
+                    SmallObjectAllocator::Deallocate(std::exchange(m_pChunks, m_pChunks->pNext));
+                }
+
+                m_pFirst = nullptr;
+            }
+
+            [[nodiscard]] inline bool Empty() const noexcept
+            {
+                return m_pFirst == nullptr;
+            }
+        };
+    } // namespace Internal
+} // namespace UN::Async
@@ -0,0 +1,249 @@
+#pragma once
+#include <UnAsync/Internal/ManualResetEvent.h>
+#include <UnAsync/Jobs/Job.h>
+#include <UnAsync/Parallel/SpinMutex.h>
+#include <algorithm>
+#include <mutex>
+
+namespace UN::Async
+{
+    class [[nodiscard]] DelayOperation final : public Internal::TimerJob
+    {
+        std::coroutine_handle<> m_AwaitingCoroutine;
+        IJobScheduler* m_pTargetScheduler;
+        JobClock::time_point m_Deadline;
+
+        inline void Execute(const JobExecutionContext&) override
+        {
+            m_AwaitingCoroutine.resume();
+        }
+
+    public:
+        inline DelayOperation(IJobScheduler* pScheduler, JobClock::time_point deadline) noexcept
+            : m_pTargetScheduler(pScheduler)
+            , m_Deadline(deadline)
+        {
+        }
+
+        [[nodiscard]] inline bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        inline void await_suspend(std::coroutine_handle<> awaitingCoroutine)
+        {
+            m_AwaitingCoroutine = awaitingCoroutine;
+            StartTimer(m_pTargetScheduler, m_Deadline);
+        }
+
+        inline void await_resume() noexcept {}
+    };
+
+    //! \brief Suspend the current coroutine and resume it on a worker of a job scheduler after a delay.
+    //!
+    //! No thread is blocked while the coroutine is suspended.
+    //!
+    //! \param pScheduler - Job scheduler.
+    //! \param duration - Minimum time to wait.
+    inline DelayOperation Delay(IJobScheduler* pScheduler, JobClock::duration duration)
+    {
+        return DelayOperation(pScheduler, JobClock::now() + duration);
+    }
+
+    //! \brief Suspend the current coroutine and resume it on a worker of a job scheduler at a point in time.
+    //!
+    //! \param pScheduler - Job scheduler.
+    //! \param deadline - The point in time to resume the coroutine at.
+    inline DelayOperation DelayUntil(IJobScheduler* pScheduler, JobClock::time_point deadline)
+    {
+        return DelayOperation(pScheduler, deadline);
+    }
+
+    //! \brief A job that calls a function periodically until stopped.
+    //!
+    //! The job runs at a fixed rate: the next run is scheduled one period after the previous deadline, so
+    //! the delays don't accumulate. If a run takes longer than the period, the missed runs are skipped.
+    //! Two runs of the same job never overlap. If the job's JobTree is cancelled, the job stops.
+    //!
+    //! \tparam TFunc - Type of the function to call.
+    template<class TFunc>
+    class PeriodicJob final : public Internal::TimerJob
+    {
+        TFunc m_Function;
+        JobClock::duration m_Period{};
+
+        SpinMutex m_Mutex;
+        bool m_IsActive        = false; //!< The timer is pending or the job is queued or running.
+        bool m_IsStopRequested = false;
+
+        //! \brief Number of threads that start the timer outside the lock.
+        //!
+        //! A timer with a passed deadline schedules the job immediately, so the next run can start the timer
+        //! again before the previous Arm() returns.
+        UInt32 m_ArmingCount = 0;
+
+        bool m_IsFinishDeferred = false; //!< A run wanted to stop the job while the timer was being started.
+        Internal::ManualResetEvent m_StoppedEvent;
+
+        inline void Execute(const JobExecutionContext&) override;
+        inline void OnCancelled() override;
+
+        //! \brief Start the timer, must be called without the lock after incrementing m_ArmingCount.
+        //!
+        //! Starting a timer can wake up or start workers, so it's not done under the spin lock.
+        inline void Arm(IJobScheduler* pScheduler, JobClock::time_point deadline);
+
+        //! \brief Mark the job as stopped, must be called under the lock.
+        //!
+        //! If other threads are still starting the timer, the last of them finishes instead. The event is set
+        //! under the lock and Stop() takes the lock after the wait, so that the job isn't destroyed before
+        //! this thread stops using it.
+        inline void Finish() noexcept
+        {
+            if (m_ArmingCount > 0)
+            {
+                m_IsFinishDeferred = true;
+                return;
+            }
+
+            m_IsActive = false;
+            m_StoppedEvent.Set();
+        }
+
+    public:
+        inline explicit PeriodicJob(TFunc&& function, JobPriority priority = JobPriority::Normal)
+            : TimerJob(priority)
+            , m_Function(std::move(function))
+        {
+        }
+
+        inline ~PeriodicJob() override
+        {
+            Stop();
+        }
+
+        //! \brief Start calling the function periodically.
+        //!
+        //! \param pScheduler - Job scheduler to run the function on.
+        //! \param period - Time between the runs.
+        //! \param firstDelay - Time before the first run.
+        inline void Start(IJobScheduler* pScheduler, JobClock::duration period, JobClock::duration firstDelay);
+
+        //! \brief Start calling the function periodically, the first run is after one period.
+        inline void Start(IJobScheduler* pScheduler, JobClock::duration period)
+        {
+            Start(pScheduler, period, period);
+        }
+
+        //! \brief Stop the job, waits for the current run to complete if the function is running.
+        //!
+        //! Must not be called from the job's own function.
+        inline void Stop();
+
+        //! \return True if the job was started and not stopped yet.
+        [[nodiscard]] inline bool IsActive()
+        {
+            std::lock_guard lk(m_Mutex);
+            return m_IsActive;
+        }
+    };
+
+    template<class TFunc>
+    void PeriodicJob<TFunc>::Execute(const JobExecutionContext&)
+    {
+        {
+            std::lock_guard lk(m_Mutex);
+            if (m_IsStopRequested)
+            {
+                Finish();
+                return;
+            }
+        }
+
+        m_Function();
+
+        JobClock::time_point deadline;
+        {
+            std::lock_guard lk(m_Mutex);
+            if (m_IsStopRequested)
+            {
+                Finish();
+                return;
+            }
+
+            deadline = std::max(m_TimerEntry.Deadline + m_Period, JobClock::now());
+            ++m_ArmingCount;
+        }
+
+        Arm(m_pScheduler, deadline);
+    }
+
+    template<class TFunc>
+    void PeriodicJob<TFunc>::OnCancelled()
+    {
+        std::lock_guard lk(m_Mutex);
+        m_IsStopRequested = true;
+        Finish();
+    }
+
+    template<class TFunc>
+    void PeriodicJob<TFunc>::Arm(IJobScheduler* pScheduler, JobClock::time_point deadline)
+    {
+        StartTimer(pScheduler, deadline);
+
+        // Stop() doesn't cancel a timer that is being started, but waits for the last arming thread to do it.
+        // Cancelling only locks the timer wheel, so it's done under the lock.
+        std::lock_guard lk(m_Mutex);
+        if (--m_ArmingCount > 0 || !m_IsStopRequested)
+        {
+            return;
+        }
+
+        if (m_IsFinishDeferred || m_pScheduler->CancelTimer(&m_TimerEntry))
+        {
+            Finish();
+        }
+    }
+
+    template<class TFunc>
+    void PeriodicJob<TFunc>::Start(IJobScheduler* pScheduler, JobClock::duration period, JobClock::duration firstDelay)
+    {
+        {
+            std::lock_guard lk(m_Mutex);
+            UN_Assert(!m_IsActive, "The periodic job is already started");
+            m_IsActive         = true;
+            m_IsStopRequested  = false;
+            m_IsFinishDeferred = false;
+            m_Period           = period;
+            ++m_ArmingCount;
+            m_StoppedEvent.Reset();
+        }
+
+        Arm(pScheduler, JobClock::now() + firstDelay);
+    }
+
+    template<class TFunc>
+    void PeriodicJob<TFunc>::Stop()
+    {
+        {
+            std::lock_guard lk(m_Mutex);
+            if (!m_IsActive)
+            {
+                return;
+            }
+
+            m_IsStopRequested = true;
+            if (m_ArmingCount == 0 && m_pScheduler->CancelTimer(&m_TimerEntry))
+            {
+                m_IsActive = false;
+                return;
+            }
+        }
+
+        // The timer is being started, has expired, or the job is queued or running: it will see the stop request
+        m_StoppedEvent.Wait();
+
+        // Finish() sets the event under the lock, wait until the job releases it
+        std::lock_guard lk(m_Mutex);
+    }
+} // namespace UN::Async
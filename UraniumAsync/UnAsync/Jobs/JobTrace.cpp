@@ -0,0 +1,134 @@
+#include <UnAsync/Jobs/JobTrace.h>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+namespace UN::Async
+{
+    namespace
+    {
+        const char* GetEventName(const JobTraceEvent& event)
+        {
+            switch (event.Type)
+            {
+            case JobTraceEventType::Execute:
+                return event.Name ? event.Name : "Job";
+            case JobTraceEventType::Steal:
+                return "Steal";
+            case JobTraceEventType::Park:
+                return "Parked";
+            case JobTraceEventType::GlobalQueueDequeue:
+                return "GlobalQueueDequeue";
+            default:
+                return "Unknown";
+            }
+        }
+
+        const char* GetEventCategory(const JobTraceEvent& event)
+        {
+            return event.Type == JobTraceEventType::Execute ? "job" : "scheduler";
+        }
+
+        char GetPhaseSymbol(JobTracePhase phase)
+        {
+            switch (phase)
+            {
+            case JobTracePhase::Begin:
+                return 'B';
+            case JobTracePhase::End:
+                return 'E';
+            default:
+                return 'i';
+            }
+        }
+
+        void WriteEscaped(std::ostream& stream, const char* string)
+        {
+            for (; *string; ++string)
+            {
+                auto c = *string;
+                switch (c)
+                {
+                case '"':
+                    stream << "\\\"";
+                    break;
+                case '\\':
+                    stream << "\\\\";
+                    break;
+                case '\n':
+                    stream << "\\n";
+                    break;
+                case '\t':
+                    stream << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                    }
+                    else
+                    {
+                        stream << c;
+                    }
+                    break;
+                }
+            }
+        }
+    } // namespace
+
+    void WriteChromeTrace(const JobTrace& trace, std::ostream& stream)
+    {
+        auto startTime = std::numeric_limits<UInt64>::max();
+        for (auto& worker : trace.Workers)
+        {
+            for (auto& event : worker.Events)
+            {
+                startTime = std::min(startTime, event.Timestamp);
+            }
+        }
+
+        auto flags     = stream.flags();
+        auto precision = stream.precision();
+        stream << std::fixed << std::setprecision(3);
+
+        stream << "{\"traceEvents\":[";
+        bool first = true;
+        for (auto& worker : trace.Workers)
+        {
+            if (!first)
+            {
+                stream << ",";
+            }
+
+            first = false;
+            stream << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << worker.WorkerID
+                   << ",\"args\":{\"name\":\"Worker " << worker.WorkerID << "\"}}";
+
+            for (auto& event : worker.Events)
+            {
+                stream << ",\n{\"name\":\"";
+                WriteEscaped(stream, GetEventName(event));
+                stream << "\",\"cat\":\"" << GetEventCategory(event) << "\",\"ph\":\"" << GetPhaseSymbol(event.Phase)
+                       << "\",\"ts\":" << static_cast<double>(event.Timestamp - startTime) / 1000.0
+                       << ",\"pid\":0,\"tid\":" << worker.WorkerID;
+
+                if (event.Phase == JobTracePhase::Instant)
+                {
+                    stream << ",\"s\":\"t\"";
+                }
+
+                if (event.Type == JobTraceEventType::Steal)
+                {
+                    stream << ",\"args\":{\"count\":" << event.Value << "}";
+                }
+
+                stream << "}";
+            }
+        }
+
+        stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+} // namespace UN::Async
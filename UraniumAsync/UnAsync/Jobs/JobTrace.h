@@ -0,0 +1,160 @@
+#pragma once
+#include <UnAsync/Parallel/WorkStealingDeque.h>
+#include <UnTL/Containers/List.h>
+#include <UnTL/Memory/Memory.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+
+#ifndef UN_ASYNC_ENABLE_TRACING
+#    define UN_ASYNC_ENABLE_TRACING 0
+#endif
+
+namespace UN::Async
+{
+    enum class JobTraceEventType : UInt8
+    {
+        Execute,           //!< A worker executes a job.
+        Steal,             //!< A worker stole jobs from another worker.
+        Park,              //!< A worker is parked waiting for new jobs.
+        GlobalQueueDequeue //!< A worker took a job from the global queue.
+    };
+
+    enum class JobTracePhase : UInt8
+    {
+        Begin,
+        End,
+        Instant
+    };
+
+    //! \brief A timestamped event recorded by a job scheduler worker.
+    struct JobTraceEvent
+    {
+        UInt64 Timestamp; //!< Time of the event in nanoseconds, measured with std::chrono::steady_clock.
+        const char* Name; //!< Name of the job for Execute events, can be nullptr.
+        UInt32 Value;     //!< Number of stolen jobs for Steal events.
+        JobTraceEventType Type;
+        JobTracePhase Phase;
+    };
+
+    //! \brief Events recorded by a single worker.
+    struct JobWorkerTrace
+    {
+        UInt32 WorkerID = 0;
+        List<JobTraceEvent> Events;
+    };
+
+    //! \brief Events recorded by all workers of a job scheduler.
+    struct JobTrace
+    {
+        List<JobWorkerTrace> Workers;
+    };
+
+    //! \brief Write a trace in Chrome trace event JSON format.
+    //!
+    //! The output can be opened in chrome://tracing or https://ui.perfetto.dev. Every worker is shown as
+    //! a separate thread, the timestamps are relative to the earliest event in the trace.
+    //!
+    //! \param trace - The trace to write.
+    //! \param stream - The stream to write the JSON to.
+    void WriteChromeTrace(const JobTrace& trace, std::ostream& stream);
+
+    namespace Internal
+    {
+        //! \return Current time in nanoseconds for trace events.
+        UN_FINLINE UInt64 GetTraceTimestamp() noexcept
+        {
+            auto time = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+        }
+
+        //! \brief A lock-free single-producer ring buffer of trace events.
+        //!
+        //! The owner worker writes events without any read-modify-write operations, when the buffer is full
+        //! the oldest events are overwritten. Other threads can read the events at any time, the events that
+        //! were overwritten during the read are dropped.
+        class JobTraceBuffer final
+        {
+            JobTraceEvent* m_pEvents;
+            UInt64 m_Mask;
+
+            alignas(CacheLineSize) std::atomic<UInt64> m_WritePosition;
+            alignas(CacheLineSize) std::atomic<UInt64> m_StartPosition;
+
+        public:
+            //! \param capacity - Maximum number of events to keep, must be a power of two.
+            inline explicit JobTraceBuffer(USize capacity)
+                : m_Mask(capacity - 1)
+                , m_WritePosition(0)
+                , m_StartPosition(0)
+            {
+                UN_Assert((capacity & m_Mask) == 0, "Capacity must be a power of two");
+                auto* allocator = SystemAllocator::Get();
+                m_pEvents       = static_cast<JobTraceEvent*>(allocator->Allocate(sizeof(JobTraceEvent) * capacity,
+                                                                                  alignof(JobTraceEvent)));
+            }
+
+            inline ~JobTraceBuffer()
+            {
+                SystemAllocator::Get()->Deallocate(m_pEvents);
+            }
+
+            JobTraceBuffer(const JobTraceBuffer&)            = delete;
+            JobTraceBuffer& operator=(const JobTraceBuffer&) = delete;
+
+            [[nodiscard]] inline USize Capacity() const noexcept
+            {
+                return static_cast<USize>(m_Mask + 1);
+            }
+
+            //! \brief Record an event. Must only be called by the owner thread.
+            UN_FINLINE void Write(const JobTraceEvent& event) noexcept
+            {
+                auto position                = m_WritePosition.load(std::memory_order_relaxed);
+                m_pEvents[position & m_Mask] = event;
+                m_WritePosition.store(position + 1, std::memory_order_release);
+            }
+
+            //! \brief Forget the events recorded so far. Can be called from any thread.
+            inline void Restart() noexcept
+            {
+                m_StartPosition.store(m_WritePosition.load(std::memory_order_acquire), std::memory_order_relaxed);
+            }
+
+            //! \brief Copy the events recorded since the last Restart() in chronological order.
+            //!
+            //! \param result - The list to append the events to.
+            inline void Read(List<JobTraceEvent>& result) const
+            {
+                const auto capacity = m_Mask + 1;
+
+                auto end   = m_WritePosition.load(std::memory_order_acquire);
+                auto begin = std::max(m_StartPosition.load(std::memory_order_relaxed), end > capacity ? end - capacity : 0);
+
+                auto firstIndex = result.Size();
+                for (auto i = begin; i < end; ++i)
+                {
+                    result.Push(m_pEvents[i & m_Mask]);
+                }
+
+                // The owner could overwrite the oldest events while they were copied
+                std::atomic_thread_fence(std::memory_order_acquire);
+                auto newEnd = m_WritePosition.load(std::memory_order_relaxed);
+                if (newEnd > capacity && newEnd - capacity > begin)
+                {
+                    auto overwritten = std::min(newEnd - capacity - begin, end - begin);
+                    for (auto i = firstIndex; i + overwritten < result.Size(); ++i)
+                    {
+                        result[i] = result[i + overwritten];
+                    }
+
+                    for (UInt64 i = 0; i < overwritten; ++i)
+                    {
+                        result.Pop();
+                    }
+                }
+            }
+        };
+    } // namespace Internal
+} // namespace UN::Async
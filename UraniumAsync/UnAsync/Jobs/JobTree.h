@@ -23,21 +23,43 @@ namespace UN::Async
 
         [[nodiscard]] inline bool IsCancelled() const
         {
-            return m_ChildCancelledPair.GetBool();
+            return m_ChildCancelledPair.GetBool(std::memory_order_acquire);
         }
 
+        //! \brief Cancel the tree and all of its descendants.
+        //!
+        //! Jobs attached to a cancelled tree that haven't started yet are skipped by the scheduler:
+        //! their bodies don't run, but their dependents are still released.
         inline void Cancel()
         {
-            m_ChildCancelledPair.SetBool(true);
+            if (m_ChildCancelledPair.SetBool(true))
+            {
+                return;
+            }
+
+            for (auto* child = GetFirstChild(); child; child = child->GetSibling())
+            {
+                child->Cancel();
+            }
         }
 
+        //! \brief Add a child tree, can be called concurrently with Cancel() and other AddChild() calls.
+        //!
+        //! The child is cancelled if this tree is already cancelled.
         inline void AddChild(JobTree* child)
         {
-            if (m_ChildCancelledPair.GetPointer())
+            auto* first = GetFirstChild();
+            do
+            {
+                child->m_pSibling = first;
+            }
+            while (!m_ChildCancelledPair.CompareExchangePointer(first, child));
+
+            // Either Cancel() sees the new child or we see the cancelled flag
+            if (IsCancelled())
             {
-                child->m_pSibling = m_ChildCancelledPair.GetPointer();
+                child->Cancel();
             }
-            m_ChildCancelledPair.SetPointer(child);
         }
 
         [[nodiscard]] inline JobTree* GetSibling() const
@@ -0,0 +1,355 @@
+#pragma once
+#include <UnAsync/Jobs/ParallelFor.h>
+#include <UnTL/Containers/List.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+
+namespace UN::Async
+{
+    class ParallelAlgorithmDesc
+    {
+    public:
+        //! \brief Number of elements processed sequentially by one job, zero selects it from the input size.
+        //!
+        //! The input is always divided into the same blocks for the same input size and block size, and the
+        //! partial results are combined in the order of the blocks, so the results depend neither on the number
+        //! of workers nor on the order in which the jobs run.
+        USize BlockSize = 0;
+
+        //! \brief Priority of the jobs.
+        JobPriority Priority = JobPriority::Normal;
+    };
+
+    namespace Internal
+    {
+        //! \brief Number of blocks the input is divided into when the block size is not set.
+        inline constexpr USize DefaultParallelBlockCount = 256;
+
+        //! \brief Minimum size of a block when the block size is not set.
+        inline constexpr USize MinParallelBlockSize = 512;
+
+        inline USize GetParallelBlockSize(const ParallelAlgorithmDesc& desc, USize elementCount) noexcept
+        {
+            if (desc.BlockSize)
+            {
+                return desc.BlockSize;
+            }
+
+            auto blockSize = (elementCount + DefaultParallelBlockCount - 1) / DefaultParallelBlockCount;
+            return std::max(blockSize, MinParallelBlockSize);
+        }
+
+        inline ParallelForDesc GetBlockLoopDesc(const ParallelAlgorithmDesc& desc) noexcept
+        {
+            ParallelForDesc result;
+            result.GrainSize   = 1;
+            result.Partitioner = ParallelForPartitioner::Adaptive;
+            result.Priority    = desc.Priority;
+            return result;
+        }
+
+        //! \brief Find how many elements of the first run are among the first `outputIndex` elements of a stable merge.
+        template<class TIterator, class TCompare>
+        inline USize MergeCoRank(TIterator pFirst, USize firstSize, TIterator pSecond, USize secondSize, USize outputIndex,
+                                 TCompare& compare)
+        {
+            auto low  = outputIndex > secondSize ? outputIndex - secondSize : 0;
+            auto high = std::min(outputIndex, firstSize);
+            while (low < high)
+            {
+                auto i = low + (high - low) / 2;
+                auto j = outputIndex - i;
+
+                // Elements of the first run go first on ties
+                if (j > 0 && !compare(pSecond[j - 1], pFirst[i]))
+                {
+                    low = i + 1;
+                }
+                else
+                {
+                    high = i;
+                }
+            }
+
+            return low;
+        }
+    } // namespace Internal
+
+    //! \brief Reduce a range of indices in parallel on a job scheduler.
+    //!
+    //! Every block of indices is reduced into its own partial result, starting from the identity, and the partial
+    //! results are reduced in order of the blocks. The result is deterministic if the reduce operation is associative,
+    //! it doesn't have to be commutative.
+    //!
+    //! \param pScheduler - The job scheduler to run the jobs on.
+    //! \param begin - The first index.
+    //! \param end - The index after the last one.
+    //! \param identity - The identity element of the reduce operation.
+    //! \param map - The function that returns a value for an index: `T(TIndex)`.
+    //! \param reduce - The associative operation that combines two values: `T(const T&, const T&)`.
+    //! \param desc - Block size and priority of the jobs.
+    //!
+    //! \return A task that returns the reduced value.
+    template<std::integral TIndex, class T, class TMap, class TReduce>
+    inline Task<T> ParallelReduce(IJobScheduler* pScheduler, TIndex begin, TIndex end, T identity, TMap map, TReduce reduce,
+                                  ParallelAlgorithmDesc desc = {})
+    {
+        if (begin >= end)
+        {
+            co_return identity;
+        }
+
+        const auto elementCount = static_cast<USize>(end - begin);
+        const auto blockSize    = Internal::GetParallelBlockSize(desc, elementCount);
+        const auto blockCount   = (elementCount + blockSize - 1) / blockSize;
+
+        List<T> partials;
+        partials.Resize(blockCount, identity);
+
+        co_await ParallelForAsync(
+            pScheduler, USize{ 0 }, blockCount,
+            [&](USize block) {
+                auto blockBegin = begin + static_cast<TIndex>(block * blockSize);
+                auto blockEnd   = begin + static_cast<TIndex>(std::min(elementCount, (block + 1) * blockSize));
+
+                T result = identity;
+                for (auto i = blockBegin; i < blockEnd; ++i)
+                {
+                    result = reduce(result, map(i));
+                }
+
+                partials[block] = std::move(result);
+            },
+            Internal::GetBlockLoopDesc(desc));
+
+        T result = std::move(identity);
+        for (auto& partial : partials)
+        {
+            result = reduce(result, partial);
+        }
+
+        co_return result;
+    }
+
+    namespace Internal
+    {
+        template<class TInput, class TOutput, class T, class TOp>
+        inline Task<> ParallelScan(IJobScheduler* pScheduler, TInput first, TInput last, TOutput output,
+                                   std::optional<T> init, TOp op, ParallelAlgorithmDesc desc)
+        {
+            const auto elementCount = static_cast<USize>(std::distance(first, last));
+            if (elementCount == 0)
+            {
+                co_return;
+            }
+
+            const auto blockSize  = GetParallelBlockSize(desc, elementCount);
+            const auto blockCount = (elementCount + blockSize - 1) / blockSize;
+            const auto loopDesc   = GetBlockLoopDesc(desc);
+
+            // Reduce every block except the last one
+            List<std::optional<T>> blockSums;
+            blockSums.Resize(blockCount);
+            co_await ParallelForAsync(
+                pScheduler, USize{ 0 }, blockCount - 1,
+                [&](USize block) {
+                    auto blockBegin = first + static_cast<std::ptrdiff_t>(block * blockSize);
+                    auto blockEnd   = blockBegin + static_cast<std::ptrdiff_t>(blockSize);
+
+                    T sum = *blockBegin;
+                    for (auto it = std::next(blockBegin); it != blockEnd; ++it)
+                    {
+                        sum = op(sum, *it);
+                    }
+
+                    blockSums[block] = std::move(sum);
+                },
+                loopDesc);
+
+            // There are few blocks, so their offsets are computed sequentially
+            const bool isExclusive = init.has_value();
+            List<std::optional<T>> blockOffsets;
+            blockOffsets.Resize(blockCount);
+            blockOffsets[0] = std::move(init);
+            for (USize block = 1; block < blockCount; ++block)
+            {
+                auto& previous      = blockOffsets[block - 1];
+                blockOffsets[block] = previous ? op(*previous, *blockSums[block - 1]) : *blockSums[block - 1];
+            }
+
+            co_await ParallelForAsync(
+                pScheduler, USize{ 0 }, blockCount,
+                [&](USize block) {
+                    auto offsetIndex = static_cast<std::ptrdiff_t>(block * blockSize);
+                    auto blockBegin  = first + offsetIndex;
+                    auto blockEnd    = first + static_cast<std::ptrdiff_t>(std::min(elementCount, (block + 1) * blockSize));
+                    auto out         = output + offsetIndex;
+
+                    std::optional<T> sum = blockOffsets[block];
+                    for (auto it = blockBegin; it != blockEnd; ++it, ++out)
+                    {
+                        if (isExclusive)
+                        {
+                            // The element is read before the output is written, so the scan works in place
+                            T value = *it;
+                            *out    = *sum;
+                            sum     = op(*sum, value);
+                        }
+                        else
+                        {
+                            sum  = sum ? op(*sum, *it) : T(*it);
+                            *out = *sum;
+                        }
+                    }
+                },
+                loopDesc);
+        }
+    } // namespace Internal
+
+    //! \brief Compute inclusive prefix sums of a range in parallel on a job scheduler.
+    //!
+    //! The input is divided into blocks: first the blocks are reduced in parallel, then the block sums are scanned
+    //! sequentially, and then the blocks are scanned in parallel starting from their offsets. The result is
+    //! deterministic if the operation is associative. The output can be the same as the input.
+    //!
+    //! \param pScheduler - The job scheduler to run the jobs on.
+    //! \param first - The beginning of the input range.
+    //! \param last - The end of the input range.
+    //! \param output - The beginning of the output range, must have the same size as the input.
+    //! \param op - The associative binary operation, std::plus by default.
+    //! \param desc - Block size and priority of the jobs.
+    template<std::random_access_iterator TInput, std::random_access_iterator TOutput, class TOp = std::plus<>>
+    inline Task<> ParallelInclusiveScan(IJobScheduler* pScheduler, TInput first, TInput last, TOutput output, TOp op = {},
+                                        ParallelAlgorithmDesc desc = {})
+    {
+        using T = typename std::iterator_traits<TInput>::value_type;
+        return Internal::ParallelScan<TInput, TOutput, T, TOp>(pScheduler, first, last, output, std::nullopt, std::move(op),
+                                                               desc);
+    }
+
+    //! \brief Compute exclusive prefix sums of a range in parallel on a job scheduler.
+    //!
+    //! Works like ParallelInclusiveScan(), but the i-th output element doesn't include the i-th input element.
+    //!
+    //! \param pScheduler - The job scheduler to run the jobs on.
+    //! \param first - The beginning of the input range.
+    //! \param last - The end of the input range.
+    //! \param output - The beginning of the output range, must have the same size as the input.
+    //! \param init - The initial value, it's the first output element.
+    //! \param op - The associative binary operation, std::plus by default.
+    //! \param desc - Block size and priority of the jobs.
+    template<std::random_access_iterator TInput, std::random_access_iterator TOutput, class T, class TOp = std::plus<>>
+    inline Task<> ParallelExclusiveScan(IJobScheduler* pScheduler, TInput first, TInput last, TOutput output, T init,
+                                        TOp op = {}, ParallelAlgorithmDesc desc = {})
+    {
+        return Internal::ParallelScan<TInput, TOutput, T, TOp>(pScheduler, first, last, output, std::move(init),
+                                                               std::move(op), desc);
+    }
+
+    //! \brief Sort a range in parallel on a job scheduler with a stable merge sort.
+    //!
+    //! The blocks of the input are sorted in parallel with std::stable_sort, then the sorted runs are merged pairwise
+    //! into a temporary buffer and back until one run remains. Every merge is itself divided into blocks of the output
+    //! with a binary search on the merge path, so all the workers take part in the last merges too.
+    //! The sort is stable, so the result is deterministic.
+    //!
+    //! \param pScheduler - The job scheduler to run the jobs on.
+    //! \param first - The beginning of the range.
+    //! \param last - The end of the range.
+    //! \param compare - The comparison function, std::less by default.
+    //! \param desc - Block size and priority of the jobs.
+    template<std::random_access_iterator TIterator, class TCompare = std::less<>>
+    inline Task<> ParallelSort(IJobScheduler* pScheduler, TIterator first, TIterator last, TCompare compare = {},
+                               ParallelAlgorithmDesc desc = {})
+    {
+        using T = typename std::iterator_traits<TIterator>::value_type;
+
+        const auto elementCount = static_cast<USize>(std::distance(first, last));
+        if (elementCount < 2)
+        {
+            co_return;
+        }
+
+        const auto blockSize  = Internal::GetParallelBlockSize(desc, elementCount);
+        const auto blockCount = (elementCount + blockSize - 1) / blockSize;
+        const auto loopDesc   = Internal::GetBlockLoopDesc(desc);
+
+        co_await ParallelForAsync(
+            pScheduler, USize{ 0 }, blockCount,
+            [&](USize block) {
+                auto blockBegin = first + static_cast<std::ptrdiff_t>(block * blockSize);
+                auto blockEnd   = first + static_cast<std::ptrdiff_t>(std::min(elementCount, (block + 1) * blockSize));
+                std::stable_sort(blockBegin, blockEnd, compare);
+            },
+            loopDesc);
+
+        if (blockCount == 1)
+        {
+            co_return;
+        }
+
+        List<T> buffer;
+        buffer.Resize(elementCount);
+
+        // Merge pairs of runs of the given width from the source to the destination
+        auto mergeRuns = [&](auto source, auto destination, USize width) -> Task<> {
+            co_await ParallelForAsync(
+                pScheduler, USize{ 0 }, blockCount,
+                [&](USize block) {
+                    auto outputBegin = block * blockSize;
+                    auto outputEnd   = std::min(elementCount, outputBegin + blockSize);
+
+                    // Runs of the pair that contains this block of the output
+                    auto pairBegin   = outputBegin / (2 * width) * (2 * width);
+                    auto firstSize   = std::min(width, elementCount - pairBegin);
+                    auto secondSize  = std::min(width, elementCount - pairBegin - firstSize);
+                    auto pFirst      = source + static_cast<std::ptrdiff_t>(pairBegin);
+                    auto pSecond     = pFirst + static_cast<std::ptrdiff_t>(firstSize);
+
+                    auto firstBegin = Internal::MergeCoRank(pFirst, firstSize, pSecond, secondSize, outputBegin - pairBegin,
+                                                            compare);
+                    auto firstEnd   = Internal::MergeCoRank(pFirst, firstSize, pSecond, secondSize, outputEnd - pairBegin,
+                                                            compare);
+                    auto secondBegin = outputBegin - pairBegin - firstBegin;
+                    auto secondEnd   = outputEnd - pairBegin - firstEnd;
+
+                    std::merge(std::make_move_iterator(pFirst + static_cast<std::ptrdiff_t>(firstBegin)),
+                               std::make_move_iterator(pFirst + static_cast<std::ptrdiff_t>(firstEnd)),
+                               std::make_move_iterator(pSecond + static_cast<std::ptrdiff_t>(secondBegin)),
+                               std::make_move_iterator(pSecond + static_cast<std::ptrdiff_t>(secondEnd)),
+                               destination + static_cast<std::ptrdiff_t>(outputBegin), compare);
+                },
+                loopDesc);
+        };
+
+        bool isInBuffer = false;
+        for (auto width = blockSize; width < elementCount; width *= 2)
+        {
+            if (isInBuffer)
+            {
+                co_await mergeRuns(buffer.Data(), first, width);
+            }
+            else
+            {
+                co_await mergeRuns(first, buffer.Data(), width);
+            }
+
+            isInBuffer = !isInBuffer;
+        }
+
+        if (isInBuffer)
+        {
+            co_await ParallelForAsync(
+                pScheduler, USize{ 0 }, blockCount,
+                [&](USize block) {
+                    auto blockBegin = block * blockSize;
+                    auto blockEnd   = std::min(elementCount, blockBegin + blockSize);
+                    std::move(buffer.Data() + blockBegin, buffer.Data() + blockEnd,
+                              first + static_cast<std::ptrdiff_t>(blockBegin));
+                },
+                loopDesc);
+        }
+    }
+} // namespace UN::Async
@@ -0,0 +1,343 @@
+#pragma once
+#include <UnAsync/AsyncEvent.h>
+#include <UnAsync/Jobs/Job.h>
+#include <UnAsync/SyncWait.h>
+#include <UnAsync/Task.h>
+#include <algorithm>
+#include <concepts>
+
+namespace UN::Async
+{
+    //! \brief Defines how ParallelFor() divides the index range between jobs.
+    enum class ParallelForPartitioner
+    {
+        //! \brief Lazy binary splitting: a job offers a half of its remaining range to thieves and splits again only
+        //! after a thief has taken the previous offer. An offer that no thief has taken is executed by the job itself.
+        Adaptive,
+
+        //! \brief The range is split into one chunk per worker up front.
+        Static,
+
+        //! \brief The range is split recursively until the chunks are not larger than the grain size.
+        Simple
+    };
+
+    class ParallelForDesc
+    {
+    public:
+        //! \brief Minimum number of indices processed without checking for thieves or splitting.
+        USize GrainSize = 1;
+
+        //! \brief The way the range is divided between jobs.
+        ParallelForPartitioner Partitioner = ParallelForPartitioner::Adaptive;
+
+        //! \brief Priority of the jobs.
+        JobPriority Priority = JobPriority::Normal;
+    };
+
+    namespace Internal
+    {
+        template<class TIndex, class TFunc>
+        class ParallelForContext;
+
+        //! \brief A part of the index range offered to other workers.
+        //!
+        //! The job is referenced by the scheduler and by the job that offered it. Whoever claims the range first,
+        //! a thief executing the job or the offering job, processes it. A reclaimed job stays in the scheduler's
+        //! queue until a worker pops it, so the loop isn't complete until every offered job is destroyed.
+        template<class TIndex, class TFunc>
+        class ParallelForRangeJob final : public Job
+        {
+            enum State : UInt32
+            {
+                Offered,
+                Taken,
+                Reclaimed
+            };
+
+            ParallelForContext<TIndex, TFunc>* m_pContext;
+            std::atomic<UInt32> m_State{ Offered };
+            std::atomic<UInt32> m_RefCount{ 2 };
+
+            inline void Execute(const JobExecutionContext&) override
+            {
+                UInt32 expected = Offered;
+                if (m_State.compare_exchange_strong(expected, Taken, std::memory_order_acq_rel))
+                {
+                    m_pContext->RunTaken(Begin, End);
+                }
+
+                Release();
+            }
+
+        public:
+            const TIndex Begin;
+            const TIndex End;
+
+            inline ParallelForRangeJob(ParallelForContext<TIndex, TFunc>* pContext, TIndex begin, TIndex end,
+                                       JobPriority priority)
+                : Job(priority)
+                , m_pContext(pContext)
+                , Begin(begin)
+                , End(end)
+            {
+            }
+
+            //! \return True if a thief has started executing the range.
+            [[nodiscard]] inline bool IsTaken() const noexcept
+            {
+                return m_State.load(std::memory_order_relaxed) == Taken;
+            }
+
+            //! \brief Claim the range back if no thief has taken it.
+            //!
+            //! \return True if the range must be processed by the caller.
+            inline bool TryReclaim() noexcept
+            {
+                UInt32 expected = Offered;
+                return m_State.compare_exchange_strong(expected, Reclaimed, std::memory_order_acq_rel);
+            }
+
+            inline void Release() noexcept
+            {
+                if (m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    auto* pContext = m_pContext;
+                    delete this;
+                    pContext->Release();
+                }
+            }
+        };
+
+        template<class TIndex, class TFunc>
+        class ParallelForContext final
+        {
+            using RangeJob = ParallelForRangeJob<TIndex, TFunc>;
+
+            TFunc& m_Body;
+            IJobScheduler* m_pScheduler;
+            ParallelForDesc m_Desc;
+
+            //! \brief Number of offered jobs that weren't destroyed yet plus one for the root range.
+            std::atomic<USize> m_PendingCount{ 1 };
+            AsyncEvent m_Completed;
+
+            inline static USize GetSize(TIndex begin, TIndex end) noexcept
+            {
+                return static_cast<USize>(end - begin);
+            }
+
+            inline void InvokeBody(TIndex begin, TIndex end)
+            {
+                if constexpr (std::is_invocable_v<TFunc&, TIndex, TIndex>)
+                {
+                    m_Body(begin, end);
+                }
+                else
+                {
+                    for (auto i = begin; i < end; ++i)
+                    {
+                        m_Body(i);
+                    }
+                }
+            }
+
+            inline RangeJob* Offer(TIndex begin, TIndex end)
+            {
+                m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+                auto* pJob = new RangeJob(this, begin, end, m_Desc.Priority);
+                pJob->Schedule(m_pScheduler);
+                return pJob;
+            }
+
+            inline void RunAdaptive(TIndex begin, TIndex end)
+            {
+                const auto grainSize = std::max<USize>(m_Desc.GrainSize, 1);
+
+                RangeJob* pOffer = nullptr;
+                while (true)
+                {
+                    while (begin < end)
+                    {
+                        // Split only if the previous offer was taken, which means there are idle workers
+                        if (GetSize(begin, end) > grainSize && (pOffer == nullptr || pOffer->IsTaken()))
+                        {
+                            if (pOffer)
+                            {
+                                pOffer->Release();
+                            }
+
+                            auto middle = begin + static_cast<TIndex>(GetSize(begin, end) / 2);
+                            pOffer      = Offer(middle, end);
+                            end         = middle;
+                        }
+
+                        auto chunkEnd = begin + static_cast<TIndex>(std::min(grainSize, GetSize(begin, end)));
+                        InvokeBody(begin, chunkEnd);
+                        begin = chunkEnd;
+                    }
+
+                    if (pOffer == nullptr)
+                    {
+                        return;
+                    }
+
+                    // Nobody wanted the last offer, so process it here without going through the scheduler
+                    auto reclaimed = pOffer->TryReclaim();
+                    begin          = pOffer->Begin;
+                    end            = pOffer->End;
+                    pOffer->Release();
+                    pOffer = nullptr;
+
+                    if (!reclaimed)
+                    {
+                        return;
+                    }
+                }
+            }
+
+            inline void RunSimple(TIndex begin, TIndex end)
+            {
+                const auto grainSize = std::max<USize>(m_Desc.GrainSize, 1);
+                while (GetSize(begin, end) > grainSize)
+                {
+                    auto middle = begin + static_cast<TIndex>(GetSize(begin, end) / 2);
+                    Offer(middle, end)->Release();
+                    end = middle;
+                }
+
+                InvokeBody(begin, end);
+            }
+
+            inline void RunStatic(TIndex begin, TIndex end)
+            {
+                const auto chunkCount = std::min<USize>(std::max<UInt32>(m_pScheduler->GetWorkerCount(), 1), GetSize(begin, end));
+                const auto chunkSize  = GetSize(begin, end) / chunkCount;
+                const auto remainder  = GetSize(begin, end) % chunkCount;
+
+                // The first chunk is processed by the caller, the rest are scheduled as jobs
+                auto firstEnd = begin + static_cast<TIndex>(chunkSize + (remainder > 0 ? 1 : 0));
+                auto chunkBegin = firstEnd;
+                for (USize i = 1; i < chunkCount; ++i)
+                {
+                    auto chunkEnd = chunkBegin + static_cast<TIndex>(chunkSize + (i < remainder ? 1 : 0));
+                    Offer(chunkBegin, chunkEnd)->Release();
+                    chunkBegin = chunkEnd;
+                }
+
+                InvokeBody(begin, firstEnd);
+            }
+
+        public:
+            inline ParallelForContext(IJobScheduler* pScheduler, TFunc& body, const ParallelForDesc& desc)
+                : m_Body(body)
+                , m_pScheduler(pScheduler)
+                , m_Desc(desc)
+            {
+            }
+
+            //! \brief Process the whole range on the calling thread, sharing it with the workers.
+            inline void Run(TIndex begin, TIndex end)
+            {
+                if (m_Desc.Partitioner == ParallelForPartitioner::Static)
+                {
+                    RunStatic(begin, end);
+                }
+                else
+                {
+                    RunTaken(begin, end);
+                }
+
+                Release();
+            }
+
+            //! \brief Process a range offered to other workers.
+            inline void RunTaken(TIndex begin, TIndex end)
+            {
+                switch (m_Desc.Partitioner)
+                {
+                case ParallelForPartitioner::Adaptive:
+                    RunAdaptive(begin, end);
+                    break;
+                case ParallelForPartitioner::Simple:
+                    RunSimple(begin, end);
+                    break;
+                case ParallelForPartitioner::Static:
+                    InvokeBody(begin, end);
+                    break;
+                }
+            }
+
+            //! \brief Mark the root range as processed or an offered job as destroyed, the last one sets the completed event.
+            inline void Release() noexcept
+            {
+                if (m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    m_Completed.Set();
+                }
+            }
+
+            //! \return An event that is set when every index has been processed.
+            [[nodiscard]] inline const AsyncEvent& GetCompletedEvent() const noexcept
+            {
+                return m_Completed;
+            }
+        };
+    } // namespace Internal
+
+    //! \brief Call a function for every index in a range, in parallel on a job scheduler.
+    //!
+    //! The calling thread processes the range together with the workers and returns when every index has been
+    //! processed. The body is called either for each index as `body(index)` or for each chunk of indices as
+    //! `body(chunkBegin, chunkEnd)`, if it's invocable with two indices.
+    //!
+    //! \param pScheduler - The job scheduler to share the range with.
+    //! \param begin - The first index.
+    //! \param end - The index after the last one.
+    //! \param body - The function to call, it can be called concurrently from multiple threads.
+    //! \param desc - Grain size, partitioner and priority of the jobs.
+    template<std::integral TIndex, class TFunc>
+    inline void ParallelFor(IJobScheduler* pScheduler, TIndex begin, TIndex end, TFunc&& body, const ParallelForDesc& desc = {})
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        Internal::ParallelForContext<TIndex, std::remove_reference_t<TFunc>> context(pScheduler, body, desc);
+        context.Run(begin, end);
+
+        auto& completed = context.GetCompletedEvent();
+        if (!completed.IsSet())
+        {
+            SyncWait(completed);
+        }
+    }
+
+    //! \brief Call a function for every index in a range, in parallel on a job scheduler.
+    //!
+    //! The returned task first moves to a worker thread, so that the offered parts of the range are pushed to
+    //! the worker's own queue, then works like ParallelFor().
+    //!
+    //! \param pScheduler - The job scheduler to run the loop on.
+    //! \param begin - The first index.
+    //! \param end - The index after the last one.
+    //! \param body - The function to call, it can be called concurrently from multiple threads.
+    //! \param desc - Grain size, partitioner and priority of the jobs.
+    //!
+    //! \return A task that completes on a worker thread when every index has been processed.
+    template<std::integral TIndex, class TFunc>
+    inline Task<> ParallelForAsync(IJobScheduler* pScheduler, TIndex begin, TIndex end, TFunc body, ParallelForDesc desc = {})
+    {
+        if (begin >= end)
+        {
+            co_return;
+        }
+
+        co_await Job::Run(pScheduler);
+
+        Internal::ParallelForContext<TIndex, TFunc> context(pScheduler, body, desc);
+        context.Run(begin, end);
+        co_await context.GetCompletedEvent();
+    }
+} // namespace UN::Async
@@ -0,0 +1,212 @@
+#include <UnAsync/Jobs/TimerWheel.h>
+#include <algorithm>
+#include <bit>
+
+namespace UN::Async::Internal
+{
+    namespace
+    {
+        inline constexpr UInt64 SlotMask = TimerWheel::SlotCount - 1;
+
+        //! \return Number of ticks covered by a slot of a level.
+        inline constexpr UInt64 GetLevelSpan(UInt32 level)
+        {
+            return UInt64{ 1 } << (TimerWheel::SlotBits * level);
+        }
+    } // namespace
+
+    TimerWheel::TimerWheel(JobClock::time_point startTime) noexcept
+        : m_StartTime(startTime)
+    {
+    }
+
+    void TimerWheel::Link(TimerWheelEntry* pEntry) noexcept
+    {
+        auto tick = std::max(pEntry->DeadlineTick, m_CurrentTick);
+
+        // A deadline that doesn't fit into the wheel is put into the last slot and re-linked when it cascades
+        auto delta = std::min(tick - m_CurrentTick, MaxTickCount - 1);
+        tick       = m_CurrentTick + delta;
+
+        auto level = delta < SlotCount ? 0 : static_cast<UInt32>(std::bit_width(delta) - 1) / SlotBits;
+        auto slot  = static_cast<UInt32>((tick >> (SlotBits * level)) & SlotMask);
+
+        auto& pHead = m_Slots[level][slot];
+        if (pHead)
+        {
+            pHead->ppPrev = &pEntry->pNext;
+        }
+
+        pEntry->pNext  = pHead;
+        pEntry->ppPrev = &pHead;
+        pEntry->Level  = level;
+        pEntry->Slot   = slot;
+        pHead          = pEntry;
+
+        m_NonEmptySlots[level] |= UInt64{ 1 } << slot;
+        ++m_Count;
+    }
+
+    void TimerWheel::Unlink(TimerWheelEntry* pEntry) noexcept
+    {
+        *pEntry->ppPrev = pEntry->pNext;
+        if (pEntry->pNext)
+        {
+            pEntry->pNext->ppPrev = pEntry->ppPrev;
+        }
+
+        if (m_Slots[pEntry->Level][pEntry->Slot] == nullptr)
+        {
+            m_NonEmptySlots[pEntry->Level] &= ~(UInt64{ 1 } << pEntry->Slot);
+        }
+
+        pEntry->pNext  = nullptr;
+        pEntry->ppPrev = nullptr;
+        --m_Count;
+    }
+
+    TimerWheelEntry* TimerWheel::DetachSlot(UInt32 level, UInt32 slot) noexcept
+    {
+        auto* pHead          = m_Slots[level][slot];
+        m_Slots[level][slot] = nullptr;
+        m_NonEmptySlots[level] &= ~(UInt64{ 1 } << slot);
+
+        for (auto* pEntry = pHead; pEntry; pEntry = pEntry->pNext)
+        {
+            pEntry->ppPrev = nullptr;
+            --m_Count;
+        }
+
+        return pHead;
+    }
+
+    void TimerWheel::ProcessTick(TimerWheelEntry*& pExpired) noexcept
+    {
+        const auto tick = m_CurrentTick;
+
+        // Move the entries of the higher levels down, starting from the highest one
+        for (UInt32 level = LevelCount - 1; level > 0; --level)
+        {
+            if ((tick & (GetLevelSpan(level) - 1)) != 0)
+            {
+                continue;
+            }
+
+            auto* pEntry = DetachSlot(level, static_cast<UInt32>((tick >> (SlotBits * level)) & SlotMask));
+            while (pEntry)
+            {
+                auto* pNext = pEntry->pNext;
+                Link(pEntry);
+                pEntry = pNext;
+            }
+        }
+
+        auto* pEntry = DetachSlot(0, static_cast<UInt32>(tick & SlotMask));
+        while (pEntry)
+        {
+            auto* pNext = pEntry->pNext;
+            if (pEntry->DeadlineTick <= tick)
+            {
+                pEntry->pNext = pExpired;
+                pExpired      = pEntry;
+            }
+            else
+            {
+                Link(pEntry);
+            }
+
+            pEntry = pNext;
+        }
+    }
+
+    bool TimerWheel::Insert(TimerWheelEntry* pEntry) noexcept
+    {
+        UN_Assert(!pEntry->IsLinked(), "The timer is already in the wheel");
+
+        // Round the deadline up, so that the entry never expires early
+        UInt64 tick = 0;
+        if (pEntry->Deadline > m_StartTime)
+        {
+            tick = static_cast<UInt64>((pEntry->Deadline - m_StartTime + TickDuration - JobClock::duration(1)) / TickDuration);
+        }
+
+        if (tick < m_CurrentTick)
+        {
+            return false;
+        }
+
+        pEntry->DeadlineTick = tick;
+        Link(pEntry);
+        return true;
+    }
+
+    bool TimerWheel::Remove(TimerWheelEntry* pEntry) noexcept
+    {
+        if (!pEntry->IsLinked())
+        {
+            return false;
+        }
+
+        Unlink(pEntry);
+        return true;
+    }
+
+    TimerWheelEntry* TimerWheel::Advance(JobClock::time_point now) noexcept
+    {
+        if (now < m_StartTime)
+        {
+            return nullptr;
+        }
+
+        const auto nowTick = static_cast<UInt64>((now - m_StartTime) / TickDuration);
+
+        TimerWheelEntry* pExpired = nullptr;
+        while (m_CurrentTick <= nowTick)
+        {
+            auto nextTick = GetNextTick();
+            if (nextTick > nowTick)
+            {
+                // Nothing to do until now, skip the empty ticks
+                m_CurrentTick = nowTick + 1;
+                break;
+            }
+
+            m_CurrentTick = nextTick;
+            ProcessTick(pExpired);
+            ++m_CurrentTick;
+        }
+
+        return pExpired;
+    }
+
+    UInt64 TimerWheel::GetNextTick() const noexcept
+    {
+        if (m_Count == 0)
+        {
+            return NoTick;
+        }
+
+        // All the entries of the first level expire within SlotCount ticks from the current one
+        auto result = NoTick;
+        if (auto mask = m_NonEmptySlots[0])
+        {
+            auto offset = std::countr_zero(std::rotr(mask, static_cast<int>(m_CurrentTick & SlotMask)));
+            result      = m_CurrentTick + static_cast<UInt64>(offset);
+        }
+
+        // The entries of higher levels can only cascade at the boundary of a slot
+        for (UInt32 level = 1; level < LevelCount; ++level)
+        {
+            if (m_NonEmptySlots[level] == 0)
+            {
+                continue;
+            }
+
+            auto span     = GetLevelSpan(level);
+            auto boundary = (m_CurrentTick + span - 1) & ~(span - 1);
+            result        = std::min(result, boundary);
+        }
+
+        return result;
+    }
+} // namespace UN::Async::Internal
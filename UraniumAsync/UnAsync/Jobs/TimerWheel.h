@@ -0,0 +1,111 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <chrono>
+
+namespace UN::Async
+{
+    class Job;
+
+    //! \brief The clock used by the job scheduler's timers.
+    using JobClock = std::chrono::steady_clock;
+
+    namespace Internal
+    {
+        //! \brief An intrusive timer node, the owner must keep it alive until it expires or is removed.
+        struct TimerWheelEntry final
+        {
+            TimerWheelEntry* pNext   = nullptr;
+            TimerWheelEntry** ppPrev = nullptr; //!< The pointer that points to this entry, null if not in a wheel.
+
+            JobClock::time_point Deadline; //!< The entry expires at or after this point in time.
+            Job* pJob = nullptr;           //!< The job to schedule when the entry expires.
+
+            UInt64 DeadlineTick = 0;
+            UInt32 Level        = 0;
+            UInt32 Slot         = 0;
+
+            [[nodiscard]] inline bool IsLinked() const noexcept
+            {
+                return ppPrev != nullptr;
+            }
+        };
+
+        //! \brief A hierarchical timer wheel.
+        //!
+        //! Time is divided into ticks of TickDuration. The wheel has LevelCount levels of SlotCount slots,
+        //! a slot of level L covers SlotCount^L ticks. An entry is put into the lowest level that can hold
+        //! its deadline. When the time reaches a slot of a higher level, its entries are moved down (cascaded).
+        //! Insert and Remove are O(1), Advance is O(1) per expired or cascaded entry. Empty slots are skipped
+        //! using a bit mask per level, so advancing over a long idle period is cheap.
+        //!
+        //! An entry never expires before its deadline, but can expire up to one tick later.
+        //! The wheel is not thread-safe.
+        class TimerWheel final
+        {
+        public:
+            inline static constexpr JobClock::duration TickDuration = std::chrono::milliseconds(1);
+            inline static constexpr UInt32 SlotBits                 = 6;
+            inline static constexpr UInt32 SlotCount                = 1 << SlotBits;
+            inline static constexpr UInt32 LevelCount               = 4;
+
+            //! \brief Number of ticks the wheel can hold, entries with later deadlines are re-inserted when reached.
+            inline static constexpr UInt64 MaxTickCount = UInt64{ 1 } << (SlotBits * LevelCount);
+
+            //! \brief The tick value used when there are no entries.
+            inline static constexpr UInt64 NoTick = ~UInt64{ 0 };
+
+        private:
+            JobClock::time_point m_StartTime;
+            UInt64 m_CurrentTick = 0; //!< The first tick that wasn't processed yet.
+            USize m_Count        = 0;
+
+            UInt64 m_NonEmptySlots[LevelCount]              = {};
+            TimerWheelEntry* m_Slots[LevelCount][SlotCount] = {};
+
+            void Link(TimerWheelEntry* pEntry) noexcept;
+            void Unlink(TimerWheelEntry* pEntry) noexcept;
+            TimerWheelEntry* DetachSlot(UInt32 level, UInt32 slot) noexcept;
+            void ProcessTick(TimerWheelEntry*& pExpired) noexcept;
+
+        public:
+            explicit TimerWheel(JobClock::time_point startTime = JobClock::now()) noexcept;
+
+            TimerWheel(const TimerWheel&)            = delete;
+            TimerWheel& operator=(const TimerWheel&) = delete;
+
+            //! \brief Add an entry, the entry's deadline must be set.
+            //!
+            //! \return False if the deadline has already passed, the entry is not added in this case.
+            bool Insert(TimerWheelEntry* pEntry) noexcept;
+
+            //! \brief Remove an entry that hasn't expired yet.
+            //!
+            //! \return True if the entry was removed, false if it's not in the wheel.
+            bool Remove(TimerWheelEntry* pEntry) noexcept;
+
+            //! \brief Process all the ticks up to a point in time.
+            //!
+            //! \param now - The current time.
+            //!
+            //! \return The expired entries linked through TimerWheelEntry::pNext, in no particular order.
+            [[nodiscard]] TimerWheelEntry* Advance(JobClock::time_point now) noexcept;
+
+            //! \return The first tick at which Advance() has work to do or NoTick if the wheel is empty.
+            //!
+            //! The tick can be earlier than the earliest deadline, when entries of the higher levels are due to cascade.
+            [[nodiscard]] UInt64 GetNextTick() const noexcept;
+
+            //! \return The point in time at which a tick starts.
+            [[nodiscard]] inline JobClock::time_point GetTickTime(UInt64 tick) const noexcept
+            {
+                return m_StartTime + TickDuration * static_cast<Int64>(tick);
+            }
+
+            //! \return Number of entries in the wheel.
+            [[nodiscard]] inline USize Size() const noexcept
+            {
+                return m_Count;
+            }
+        };
+    } // namespace Internal
+} // namespace UN::Async
@@ -0,0 +1,287 @@
+#pragma once
+#include <UnAsync/Parallel/HazardPointer.h>
+#include <UnAsync/Parallel/SpinMutex.h>
+#include <UnAsync/Parallel/WorkStealingDeque.h>
+#include <UnTL/Containers/List.h>
+#include <UnTL/Memory/Memory.h>
+#include <mutex>
+
+namespace UN::Async
+{
+    namespace Internal
+    {
+        template<class T>
+        struct ConcurrentQueueSegment final
+        {
+            inline static constexpr UInt64 Size = 1024;
+
+            struct Cell
+            {
+                std::atomic<T> Value;
+                std::atomic_bool IsReady;
+            };
+
+            alignas(CacheLineSize) std::atomic<UInt64> EnqueuePosition;
+            alignas(CacheLineSize) std::atomic<UInt64> DequeuePosition;
+            alignas(CacheLineSize) std::atomic<ConcurrentQueueSegment*> pNext;
+            Cell Cells[Size];
+
+            inline void Reset() noexcept
+            {
+                for (auto& cell : Cells)
+                {
+                    cell.Value.store(T{}, std::memory_order_relaxed);
+                    cell.IsReady.store(false, std::memory_order_relaxed);
+                }
+
+                DequeuePosition.store(0, std::memory_order_relaxed);
+                EnqueuePosition.store(0, std::memory_order_relaxed);
+                pNext.store(nullptr, std::memory_order_relaxed);
+            }
+        };
+    } // namespace Internal
+
+    //! \brief A lock-free unbounded multi-producer multi-consumer FIFO queue.
+    //!
+    //! The queue is a linked list of fixed-size segments. Producers claim a cell in the tail segment with
+    //! a single fetch_add, consumers claim a published cell in the head segment with a single CAS. When the
+    //! tail segment is full a producer links a new segment, when the head segment is exhausted a consumer
+    //! unlinks it. Unlinked segments are protected with hazard pointers and recycled when no thread can
+    //! access them anymore, so in steady state the queue doesn't allocate memory.
+    //!
+    //! \tparam T - Type of elements, must be a pointer type.
+    template<class T>
+    class ConcurrentQueue final
+    {
+        static_assert(std::is_pointer_v<T>, "ConcurrentQueue can only store pointers");
+
+        using Segment = Internal::ConcurrentQueueSegment<T>;
+
+        alignas(Internal::CacheLineSize) std::atomic<Segment*> m_pHead;
+        alignas(Internal::CacheLineSize) std::atomic<Segment*> m_pTail;
+
+        alignas(Internal::CacheLineSize) SpinMutex m_SegmentMutex;
+        List<Segment*> m_RetiredSegments;
+        List<Segment*> m_FreeSegments;
+        List<Segment*> m_AllSegments;
+
+        inline Segment* AllocateSegment();
+        inline void RetireSegment(Segment* pSegment);
+
+    public:
+        inline ConcurrentQueue();
+        inline ~ConcurrentQueue();
+
+        ConcurrentQueue(const ConcurrentQueue&)            = delete;
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+        //! \brief Add an element to the end of the queue. Can be called from any thread.
+        //!
+        //! \param value - The element to add.
+        inline void Enqueue(T value);
+
+        //! \brief Remove an element from the beginning of the queue. Can be called from any thread.
+        //!
+        //! \return The removed element or nullptr if the queue was empty.
+        inline T Dequeue();
+
+        //! \brief Check if the queue is empty without locks and without read-modify-write operations.
+        //!
+        //! \return True if the queue was empty at the moment of the call.
+        [[nodiscard]] inline bool Empty() const noexcept;
+    };
+
+    template<class T>
+    ConcurrentQueue<T>::ConcurrentQueue()
+    {
+        auto* pSegment = AllocateSegment();
+        m_pHead.store(pSegment, std::memory_order_relaxed);
+        m_pTail.store(pSegment, std::memory_order_relaxed);
+    }
+
+    template<class T>
+    ConcurrentQueue<T>::~ConcurrentQueue()
+    {
+        auto* allocator = SystemAllocator::Get();
+        for (auto* pSegment : m_AllSegments)
+        {
+            pSegment->~Segment();
+            allocator->Deallocate(pSegment);
+        }
+    }
+
+    template<class T>
+    typename ConcurrentQueue<T>::Segment* ConcurrentQueue<T>::AllocateSegment()
+    {
+        Segment* pSegment;
+        {
+            std::unique_lock lk(m_SegmentMutex);
+            if (m_FreeSegments.Any())
+            {
+                pSegment = m_FreeSegments.Pop();
+            }
+            else
+            {
+                auto* allocator = SystemAllocator::Get();
+                pSegment        = new (allocator->Allocate(sizeof(Segment), alignof(Segment))) Segment;
+                m_AllSegments.Push(pSegment);
+            }
+        }
+
+        pSegment->Reset();
+        return pSegment;
+    }
+
+    template<class T>
+    void ConcurrentQueue<T>::RetireSegment(Segment* pSegment)
+    {
+        std::unique_lock lk(m_SegmentMutex);
+        m_RetiredSegments.Push(pSegment);
+
+        for (USize i = 0; i < m_RetiredSegments.Size();)
+        {
+            if (Internal::IsHazardous(m_RetiredSegments[i]))
+            {
+                ++i;
+                continue;
+            }
+
+            m_FreeSegments.Push(m_RetiredSegments[i]);
+            m_RetiredSegments[i] = m_RetiredSegments.Back();
+            m_RetiredSegments.Pop();
+        }
+    }
+
+    template<class T>
+    void ConcurrentQueue<T>::Enqueue(T value)
+    {
+        auto* pHazard = Internal::GetHazardRecord();
+        while (true)
+        {
+            auto* pTail = pHazard->Protect(m_pTail);
+            auto index  = pTail->EnqueuePosition.fetch_add(1, std::memory_order_acq_rel);
+            if (index < Segment::Size)
+            {
+                auto& cell = pTail->Cells[index];
+                cell.Value.store(value, std::memory_order_relaxed);
+                cell.IsReady.store(true, std::memory_order_release);
+                pHazard->Clear();
+                return;
+            }
+
+            auto* pNext = pTail->pNext.load(std::memory_order_acquire);
+            if (pNext == nullptr)
+            {
+                // The tail segment is full, link a new one with the value already stored in it
+                auto* pSegment = AllocateSegment();
+                pSegment->EnqueuePosition.store(1, std::memory_order_relaxed);
+                pSegment->Cells[0].Value.store(value, std::memory_order_relaxed);
+                pSegment->Cells[0].IsReady.store(true, std::memory_order_relaxed);
+
+                if (pTail->pNext.compare_exchange_strong(pNext, pSegment, std::memory_order_acq_rel))
+                {
+                    m_pTail.compare_exchange_strong(pTail, pSegment, std::memory_order_acq_rel);
+                    pHazard->Clear();
+                    return;
+                }
+
+                std::unique_lock lk(m_SegmentMutex);
+                m_FreeSegments.Push(pSegment);
+            }
+
+            m_pTail.compare_exchange_strong(pTail, pNext, std::memory_order_acq_rel);
+        }
+    }
+
+    template<class T>
+    T ConcurrentQueue<T>::Dequeue()
+    {
+        auto* pHazard = Internal::GetHazardRecord();
+        while (true)
+        {
+            auto* pHead   = pHazard->Protect(m_pHead);
+            auto position = pHead->DequeuePosition.load(std::memory_order_acquire);
+
+            if (position >= Segment::Size)
+            {
+                auto* pNext = pHead->pNext.load(std::memory_order_acquire);
+                if (pNext == nullptr)
+                {
+                    pHazard->Clear();
+                    return T{};
+                }
+
+                // Make sure the tail doesn't point to the segment that is about to be retired
+                auto* pTail = pHead;
+                m_pTail.compare_exchange_strong(pTail, pNext, std::memory_order_acq_rel);
+
+                auto* pExpected = pHead;
+                if (m_pHead.compare_exchange_strong(pExpected, pNext, std::memory_order_acq_rel))
+                {
+                    pHazard->Clear();
+                    RetireSegment(pHead);
+                }
+
+                continue;
+            }
+
+            auto& cell = pHead->Cells[position];
+            if (!cell.IsReady.load(std::memory_order_acquire))
+            {
+                if (pHead->EnqueuePosition.load(std::memory_order_acquire) <= position)
+                {
+                    pHazard->Clear();
+                    return T{};
+                }
+
+                // A producer has claimed the cell, but hasn't published the value yet
+                Internal::SpinLockWait wait;
+                for (Int32 i = 0; i < 8 && !cell.IsReady.load(std::memory_order_acquire); ++i)
+                {
+                    wait.Wait();
+                }
+
+                if (!cell.IsReady.load(std::memory_order_acquire))
+                {
+                    pHazard->Clear();
+                    return T{};
+                }
+            }
+
+            T value = cell.Value.load(std::memory_order_relaxed);
+            if (pHead->DequeuePosition.compare_exchange_strong(position, position + 1, std::memory_order_acq_rel))
+            {
+                pHazard->Clear();
+                return value;
+            }
+        }
+    }
+
+    template<class T>
+    bool ConcurrentQueue<T>::Empty() const noexcept
+    {
+        // Segments are never returned to the system while the queue is alive, so it's safe to read
+        // a segment here without protecting it. If the head changes during the check, the check is repeated.
+        while (true)
+        {
+            auto* pHead   = m_pHead.load(std::memory_order_acquire);
+            auto position = pHead->DequeuePosition.load(std::memory_order_acquire);
+
+            bool result;
+            if (position >= Segment::Size)
+            {
+                auto* pNext = pHead->pNext.load(std::memory_order_acquire);
+                result      = pNext == nullptr || pNext->EnqueuePosition.load(std::memory_order_acquire) == 0;
+            }
+            else
+            {
+                result = pHead->EnqueuePosition.load(std::memory_order_acquire) <= position;
+            }
+
+            if (m_pHead.load(std::memory_order_acquire) == pHead)
+            {
+                return result;
+            }
+        }
+    }
+} // namespace UN::Async
@@ -0,0 +1,326 @@
+#include <UnAsync/Internal/PlatformInclude.h>
+#include <UnAsync/Parallel/CpuTopology.h>
+#include <thread>
+
+#if UN_LINUX
+#    include <cstdlib>
+#    include <fstream>
+#    include <pthread.h>
+#    include <sched.h>
+#    include <string>
+
+namespace
+{
+    using namespace UN;
+    using namespace UN::Async;
+
+    const std::string CpuDirectory  = "/sys/devices/system/cpu/";
+    const std::string NodeDirectory = "/sys/devices/system/node/";
+
+    bool ReadLine(const std::string& path, std::string& result)
+    {
+        std::ifstream file(path);
+        return file && std::getline(file, result);
+    }
+
+    bool ReadUInt32(const std::string& path, UInt32& result)
+    {
+        std::string line;
+        if (!ReadLine(path, line) || line.empty())
+        {
+            return false;
+        }
+
+        result = static_cast<UInt32>(std::strtoul(line.c_str(), nullptr, 10));
+        return true;
+    }
+
+    // Parses the kernel's cpu list format, e.g. "0-3,8,10-11".
+    List<UInt32> ParseCpuList(const std::string& cpuList)
+    {
+        List<UInt32> result;
+
+        const char* current = cpuList.c_str();
+        while (*current)
+        {
+            char* end;
+            auto first = static_cast<UInt32>(std::strtoul(current, &end, 10));
+            if (end == current)
+            {
+                break;
+            }
+
+            auto last = first;
+            if (*end == '-')
+            {
+                current = end + 1;
+                last    = static_cast<UInt32>(std::strtoul(current, &end, 10));
+            }
+
+            for (auto cpu = first; cpu <= last; ++cpu)
+            {
+                result.Push(cpu);
+            }
+
+            current = *end == ',' ? end + 1 : end;
+        }
+
+        return result;
+    }
+
+    bool ReadCpuList(const std::string& path, List<UInt32>& result)
+    {
+        std::string line;
+        if (!ReadLine(path, line))
+        {
+            return false;
+        }
+
+        result = ParseCpuList(line);
+        return true;
+    }
+
+    CpuInfo* FindCpu(List<CpuInfo>& cpus, UInt32 cpuID)
+    {
+        for (auto& cpu : cpus)
+        {
+            if (cpu.ID == cpuID)
+            {
+                return &cpu;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool ReadL3CacheID(const std::string& cpuPath, UInt32& result)
+    {
+        for (UInt32 index = 0;; ++index)
+        {
+            auto cachePath = cpuPath + "cache/index" + std::to_string(index) + "/";
+
+            UInt32 level;
+            if (!ReadUInt32(cachePath + "level", level))
+            {
+                return false;
+            }
+
+            if (level != 3)
+            {
+                continue;
+            }
+
+            if (ReadUInt32(cachePath + "id", result))
+            {
+                return true;
+            }
+
+            // Older kernels don't export cache IDs, use the first processor that shares the cache instead
+            List<UInt32> sharedCpus;
+            if (ReadCpuList(cachePath + "shared_cpu_list", sharedCpus) && sharedCpus.Any())
+            {
+                result = sharedCpus[0];
+                return true;
+            }
+
+            return false;
+        }
+    }
+} // namespace
+#endif
+
+namespace UN::Async
+{
+#if UN_WINDOWS
+    List<CpuInfo> QueryCpuTopology()
+    {
+        List<CpuInfo> result;
+
+        // Threads can't be pinned to the processors outside of the process affinity mask
+        DWORD_PTR processMask = ~static_cast<DWORD_PTR>(0);
+        DWORD_PTR systemMask;
+        GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+        // Only the first processor group is supported, a thread can't be pinned to other groups with a simple mask
+        auto cpuCount = std::min<UInt32>(GetActiveProcessorCount(0), 64);
+        for (UInt32 i = 0; i < cpuCount; ++i)
+        {
+            if ((processMask & (static_cast<DWORD_PTR>(1) << i)) == 0)
+            {
+                continue;
+            }
+
+            CpuInfo& cpu = result.Emplace();
+            cpu.ID       = i;
+        }
+
+        DWORD length = 0;
+        GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+
+        List<Byte> buffer;
+        buffer.Resize(length);
+        auto* pFirst = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.Data());
+        if (!GetLogicalProcessorInformationEx(RelationAll, pFirst, &length))
+        {
+            return result;
+        }
+
+        auto forEachCpu = [&result](const GROUP_AFFINITY& affinity, auto&& function) {
+            if (affinity.Group != 0)
+            {
+                return;
+            }
+
+            for (auto& cpu : result)
+            {
+                if (affinity.Mask & (static_cast<KAFFINITY>(1) << cpu.ID))
+                {
+                    function(cpu);
+                }
+            }
+        };
+
+        UInt32 coreID    = 0;
+        UInt32 packageID = 0;
+        UInt32 cacheID   = 0;
+        for (DWORD offset = 0; offset < length;)
+        {
+            auto* pInfo = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.Data() + offset);
+            switch (pInfo->Relationship)
+            {
+            case RelationProcessorCore:
+                forEachCpu(pInfo->Processor.GroupMask[0], [coreID](CpuInfo& cpu) {
+                    cpu.CoreID = coreID;
+                });
+                ++coreID;
+                break;
+            case RelationProcessorPackage:
+                for (WORD i = 0; i < pInfo->Processor.GroupCount; ++i)
+                {
+                    forEachCpu(pInfo->Processor.GroupMask[i], [packageID](CpuInfo& cpu) {
+                        cpu.PackageID = packageID;
+                    });
+                }
+                ++packageID;
+                break;
+            case RelationNumaNode:
+                forEachCpu(pInfo->NumaNode.GroupMask, [pInfo](CpuInfo& cpu) {
+                    cpu.NumaNodeID = pInfo->NumaNode.NodeNumber;
+                });
+                break;
+            case RelationCache:
+                if (pInfo->Cache.Level == 3)
+                {
+                    forEachCpu(pInfo->Cache.GroupMask, [cacheID](CpuInfo& cpu) {
+                        cpu.L3CacheID = cacheID;
+                    });
+                    ++cacheID;
+                }
+                break;
+            default:
+                break;
+            }
+
+            offset += pInfo->Size;
+        }
+
+        return result;
+    }
+
+    bool PinCurrentThreadToCpu(UInt32 cpuID)
+    {
+        if (cpuID >= 64)
+        {
+            return false;
+        }
+
+        return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpuID) != 0;
+    }
+#else
+    List<CpuInfo> QueryCpuTopology()
+    {
+        List<CpuInfo> result;
+
+        // Threads can't be pinned to the processors outside of the affinity mask, e.g. when started with taskset or in
+        // a container with a cpuset. The mask can't be queried with a static cpu_set_t on machines with more than
+        // CPU_SETSIZE processors, all online processors are used then.
+        cpu_set_t affinity;
+        CPU_ZERO(&affinity);
+        bool hasAffinity = sched_getaffinity(0, sizeof(affinity), &affinity) == 0;
+        auto isAllowed   = [&](UInt32 cpuID) {
+            return !hasAffinity || (cpuID < CPU_SETSIZE && CPU_ISSET(cpuID, &affinity));
+        };
+
+        List<UInt32> onlineCpus;
+        if (!ReadCpuList(CpuDirectory + "online", onlineCpus) || onlineCpus.Empty())
+        {
+            auto cpuCount = std::max(std::thread::hardware_concurrency(), 1u);
+            for (UInt32 i = 0; i < cpuCount; ++i)
+            {
+                if (isAllowed(i))
+                {
+                    CpuInfo& cpu = result.Emplace();
+                    cpu.ID       = i;
+                }
+            }
+
+            return result;
+        }
+
+        for (auto cpuID : onlineCpus)
+        {
+            if (!isAllowed(cpuID))
+            {
+                continue;
+            }
+
+            auto cpuPath = CpuDirectory + "cpu" + std::to_string(cpuID) + "/";
+
+            CpuInfo& cpu = result.Emplace();
+            cpu.ID       = cpuID;
+            ReadUInt32(cpuPath + "topology/core_id", cpu.CoreID);
+            ReadUInt32(cpuPath + "topology/physical_package_id", cpu.PackageID);
+            if (!ReadL3CacheID(cpuPath, cpu.L3CacheID))
+            {
+                cpu.L3CacheID = cpu.PackageID;
+            }
+        }
+
+        List<UInt32> onlineNodes;
+        if (ReadCpuList(NodeDirectory + "online", onlineNodes))
+        {
+            for (auto nodeID : onlineNodes)
+            {
+                List<UInt32> nodeCpus;
+                if (!ReadCpuList(NodeDirectory + "node" + std::to_string(nodeID) + "/cpulist", nodeCpus))
+                {
+                    continue;
+                }
+
+                for (auto cpuID : nodeCpus)
+                {
+                    if (auto* cpu = FindCpu(result, cpuID))
+                    {
+                        cpu->NumaNodeID = nodeID;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool PinCurrentThreadToCpu(UInt32 cpuID)
+    {
+        if (cpuID >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpuID, &cpuSet);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+    }
+#endif
+} // namespace UN::Async
@@ -0,0 +1,32 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <UnTL/Containers/List.h>
+
+namespace UN::Async
+{
+    //! \brief Location of a logical processor in the machine topology.
+    struct CpuInfo
+    {
+        UInt32 ID         = 0; //!< Index of the logical processor, used for thread pinning.
+        UInt32 CoreID     = 0; //!< ID of the physical core, shared by SMT siblings.
+        UInt32 PackageID  = 0; //!< ID of the physical package (socket).
+        UInt32 NumaNodeID = 0; //!< ID of the NUMA node.
+        UInt32 L3CacheID  = 0; //!< ID of the last level cache, shared by the processors that use it.
+    };
+
+    //! \brief Query the logical processors available on the current machine.
+    //!
+    //! On Linux the topology is read from /sys/devices/system/cpu and /sys/devices/system/node.
+    //! Processors with unknown location get zero IDs, so they are treated as equidistant. Processors outside
+    //! of the affinity mask of the calling thread (the process affinity mask on Windows) are skipped.
+    //!
+    //! \return A list of online logical processors available to the caller sorted by ID.
+    List<CpuInfo> QueryCpuTopology();
+
+    //! \brief Restrict the calling thread to run only on the specified logical processor.
+    //!
+    //! \param cpuID - ID of the logical processor as returned by QueryCpuTopology().
+    //!
+    //! \return True if the affinity was set successfully.
+    bool PinCurrentThreadToCpu(UInt32 cpuID);
+} // namespace UN::Async
@@ -0,0 +1,107 @@
+#include <UnAsync/Internal/PlatformInclude.h>
+#include <UnAsync/Parallel/EventCount.h>
+
+#if UN_LINUX
+#    include <climits>
+
+namespace
+{
+    int futex(int* UserAddress, int FutexOperation, int Value, const struct timespec* timeout, int* UserAddress2, int Value3)
+    {
+        return syscall(SYS_futex, UserAddress, FutexOperation, Value, timeout, UserAddress2, Value3);
+    }
+} // namespace
+#endif
+
+namespace UN::Async
+{
+    EventCount::EventCount() noexcept
+        : m_Epoch(0)
+        , m_WaiterCount(0)
+    {
+    }
+
+    EventCount::Key EventCount::PrepareWait() noexcept
+    {
+        m_WaiterCount.fetch_add(1, std::memory_order_seq_cst);
+        auto epoch = m_Epoch.load(std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return Key(epoch);
+    }
+
+    void EventCount::CancelWait() noexcept
+    {
+        m_WaiterCount.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    void EventCount::Wait(Key key) noexcept
+    {
+        while (m_Epoch.load(std::memory_order_acquire) == key.m_Epoch)
+        {
+#if UN_WINDOWS
+            ::WaitOnAddress(&m_Epoch, &key.m_Epoch, sizeof(m_Epoch), INFINITE);
+#else
+            futex(reinterpret_cast<int*>(&m_Epoch), FUTEX_WAIT_PRIVATE, static_cast<int>(key.m_Epoch), nullptr, nullptr, 0);
+#endif
+        }
+
+        m_WaiterCount.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    bool EventCount::Wait(Key key, std::chrono::nanoseconds timeout) noexcept
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        bool notified = false;
+        while (!notified)
+        {
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::nanoseconds::zero())
+            {
+                break;
+            }
+
+#if UN_WINDOWS
+            // Round up, so that the thread doesn't wake up before the deadline and spin
+            auto milliseconds = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+            ::WaitOnAddress(&m_Epoch, &key.m_Epoch, sizeof(m_Epoch), static_cast<DWORD>(milliseconds));
+#else
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+            timespec relativeTimeout{ static_cast<time_t>(nanoseconds / 1'000'000'000),
+                                      static_cast<long>(nanoseconds % 1'000'000'000) };
+            auto* pEpoch = reinterpret_cast<int*>(&m_Epoch);
+            futex(pEpoch, FUTEX_WAIT_PRIVATE, static_cast<int>(key.m_Epoch), &relativeTimeout, nullptr, 0);
+#endif
+            notified = m_Epoch.load(std::memory_order_acquire) != key.m_Epoch;
+        }
+
+        m_WaiterCount.fetch_sub(1, std::memory_order_seq_cst);
+        return notified;
+    }
+
+    void EventCount::Notify(bool all) noexcept
+    {
+        // Pairs with the fence in PrepareWait(): either the waiter sees the changed condition
+        // or we see the waiter.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_WaiterCount.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+
+#if UN_WINDOWS
+        if (all)
+        {
+            ::WakeByAddressAll(&m_Epoch);
+        }
+        else
+        {
+            ::WakeByAddressSingle(&m_Epoch);
+        }
+#else
+        futex(reinterpret_cast<int*>(&m_Epoch), FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+#endif
+    }
+} // namespace UN::Async
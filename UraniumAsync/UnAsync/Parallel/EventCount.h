@@ -0,0 +1,81 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <atomic>
+#include <chrono>
+
+namespace UN::Async
+{
+    //! \brief A condition variable for lock-free algorithms.
+    //!
+    //! A waiting thread first calls PrepareWait(), then checks the condition (e.g. that a queue is empty)
+    //! and either calls CancelWait() if the condition changed or Wait() to block. A notifying thread changes
+    //! the condition and then calls NotifyOne() or NotifyAll(). A notification that happens after
+    //! PrepareWait() is never lost, and notifications are almost free when there are no waiters.
+    //!
+    //! Blocking is implemented with futex on Linux and WaitOnAddress on Windows.
+    class EventCount final
+    {
+        std::atomic<UInt32> m_Epoch;
+        std::atomic<UInt32> m_WaiterCount;
+
+        void Notify(bool all) noexcept;
+
+    public:
+        class Key final
+        {
+            friend class EventCount;
+
+            UInt32 m_Epoch;
+
+            inline explicit Key(UInt32 epoch) noexcept
+                : m_Epoch(epoch)
+            {
+            }
+        };
+
+        EventCount() noexcept;
+        ~EventCount() = default;
+
+        EventCount(const EventCount&)            = delete;
+        EventCount& operator=(const EventCount&) = delete;
+
+        //! \brief Register the calling thread as a waiter.
+        //!
+        //! \return A key that must be passed to Wait().
+        Key PrepareWait() noexcept;
+
+        //! \brief Unregister the calling thread after PrepareWait() without waiting.
+        void CancelWait() noexcept;
+
+        //! \brief Block until a notification that happened after the corresponding PrepareWait().
+        //!
+        //! \param key - The key returned by PrepareWait().
+        void Wait(Key key) noexcept;
+
+        //! \brief Block until a notification that happened after the corresponding PrepareWait() or until a timeout.
+        //!
+        //! \param key - The key returned by PrepareWait().
+        //! \param timeout - Maximum time to wait.
+        //!
+        //! \return True if the thread was notified, false if the timeout elapsed.
+        bool Wait(Key key, std::chrono::nanoseconds timeout) noexcept;
+
+        //! \brief Wake up one waiting thread if there is any.
+        inline void NotifyOne() noexcept
+        {
+            Notify(false);
+        }
+
+        //! \brief Wake up all waiting threads.
+        inline void NotifyAll() noexcept
+        {
+            Notify(true);
+        }
+
+        //! \return Number of threads that called PrepareWait() and didn't return from Wait() yet.
+        [[nodiscard]] inline UInt32 GetWaiterCount() const noexcept
+        {
+            return m_WaiterCount.load(std::memory_order_relaxed);
+        }
+    };
+} // namespace UN::Async
@@ -0,0 +1,92 @@
+#include <UnAsync/Parallel/HazardPointer.h>
+#include <UnTL/Memory/Memory.h>
+
+namespace UN::Async::Internal
+{
+    //! \brief Global lock-free list of hazard records. The records are never freed, but they are reused
+    //! when the threads that owned them exit.
+    class HazardRecordList final
+    {
+        std::atomic<HazardRecord*> m_pHead{ nullptr };
+
+    public:
+        inline static HazardRecordList& Get()
+        {
+            static HazardRecordList list;
+            return list;
+        }
+
+        inline HazardRecord* Acquire()
+        {
+            for (auto* pRecord = m_pHead.load(std::memory_order_acquire); pRecord; pRecord = pRecord->m_pNext)
+            {
+                if (!pRecord->m_IsActive.load(std::memory_order_relaxed)
+                    && !pRecord->m_IsActive.exchange(true, std::memory_order_acquire))
+                {
+                    return pRecord;
+                }
+            }
+
+            auto* allocator = SystemAllocator::Get();
+            auto* pRecord   = new (allocator->Allocate(sizeof(HazardRecord), alignof(HazardRecord))) HazardRecord;
+            pRecord->m_IsActive.store(true, std::memory_order_relaxed);
+
+            auto* pHead = m_pHead.load(std::memory_order_relaxed);
+            do
+            {
+                pRecord->m_pNext = pHead;
+            }
+            while (!m_pHead.compare_exchange_weak(pHead, pRecord, std::memory_order_release, std::memory_order_relaxed));
+
+            return pRecord;
+        }
+
+        inline void Release(HazardRecord* pRecord)
+        {
+            pRecord->Clear();
+            pRecord->m_IsActive.store(false, std::memory_order_release);
+        }
+
+        inline bool IsHazardous(const void* pointer)
+        {
+            for (auto* pRecord = m_pHead.load(std::memory_order_acquire); pRecord; pRecord = pRecord->m_pNext)
+            {
+                if (pRecord->m_Pointer.load(std::memory_order_seq_cst) == pointer)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    namespace
+    {
+        struct ThreadHazardRecord final
+        {
+            HazardRecord* pRecord;
+
+            inline ThreadHazardRecord()
+                : pRecord(HazardRecordList::Get().Acquire())
+            {
+            }
+
+            inline ~ThreadHazardRecord()
+            {
+                HazardRecordList::Get().Release(pRecord);
+            }
+        };
+    } // namespace
+
+    HazardRecord* GetHazardRecord()
+    {
+        static thread_local ThreadHazardRecord record;
+        return record.pRecord;
+    }
+
+    bool IsHazardous(const void* pointer)
+    {
+        return HazardRecordList::Get().IsHazardous(pointer);
+    }
+} // namespace UN::Async::Internal
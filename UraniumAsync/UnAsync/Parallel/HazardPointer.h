@@ -0,0 +1,66 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+#include <atomic>
+
+namespace UN::Async::Internal
+{
+    //! \brief A single hazard pointer slot owned by one thread.
+    //!
+    //! A thread publishes a pointer to a shared node in its record before dereferencing it. A node that
+    //! was unlinked from a lock-free data structure is not reused or freed until no record points to it.
+    //! Every thread owns exactly one record, so protected operations must not nest.
+    class HazardRecord final
+    {
+        friend class HazardRecordList;
+
+        std::atomic<const void*> m_Pointer;
+        std::atomic_bool m_IsActive;
+        HazardRecord* m_pNext;
+
+    public:
+        inline HazardRecord() noexcept
+            : m_Pointer(nullptr)
+            , m_IsActive(false)
+            , m_pNext(nullptr)
+        {
+        }
+
+        //! \brief Load a pointer from an atomic variable and protect it from being reclaimed.
+        //!
+        //! \param source - The atomic variable to load the pointer from.
+        //!
+        //! \return The protected pointer.
+        template<class T>
+        inline T* Protect(const std::atomic<T*>& source) noexcept
+        {
+            auto* pointer = source.load(std::memory_order_acquire);
+            while (true)
+            {
+                m_Pointer.store(pointer, std::memory_order_seq_cst);
+                auto* validated = source.load(std::memory_order_seq_cst);
+                if (validated == pointer)
+                {
+                    return pointer;
+                }
+
+                pointer = validated;
+            }
+        }
+
+        //! \brief Release the protected pointer.
+        inline void Clear() noexcept
+        {
+            m_Pointer.store(nullptr, std::memory_order_release);
+        }
+    };
+
+    //! \return The hazard record of the calling thread.
+    HazardRecord* GetHazardRecord();
+
+    //! \brief Check if a pointer is protected by any thread.
+    //!
+    //! \param pointer - The pointer to check.
+    //!
+    //! \return True if the pointer is protected and the memory it points to must not be reused.
+    bool IsHazardous(const void* pointer);
+} // namespace UN::Async::Internal
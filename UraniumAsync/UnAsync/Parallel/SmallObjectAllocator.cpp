@@ -0,0 +1,281 @@
+#include <UnAsync/Parallel/SmallObjectAllocator.h>
+#include <UnAsync/Parallel/SpinMutex.h>
+#include <UnAsync/Parallel/WorkStealingDeque.h>
+#include <UnTL/Containers/List.h>
+#include <UnTL/Memory/Memory.h>
+#include <iterator>
+#include <mutex>
+
+namespace UN::Async::Internal
+{
+    namespace
+    {
+        class ThreadCache;
+
+        inline constexpr USize BlockSizes[]    = { 64, 128, 192, 256, 512, 1024 };
+        inline constexpr UInt32 SizeClassCount = static_cast<UInt32>(std::size(BlockSizes));
+        inline constexpr UInt32 LargeSizeClass = SizeClassCount;
+
+        //! \brief Maximum size of free blocks of one size class a thread keeps, the rest is returned to the system.
+        inline constexpr USize MaxCachedBytes = 256 * 1024;
+
+        struct alignas(SmallObjectAllocator::Alignment) BlockHeader final
+        {
+            ThreadCache* pOwner;
+            UInt32 SizeClass;
+        };
+
+        static_assert(sizeof(BlockHeader) == SmallObjectAllocator::Alignment);
+        static_assert(SmallObjectAllocator::MaxSize + sizeof(BlockHeader) == BlockSizes[SizeClassCount - 1]);
+
+        //! \brief A block that is not in use. The header is preserved, the link is stored in the payload.
+        struct FreeBlock final
+        {
+            BlockHeader Header;
+            FreeBlock* pNext;
+        };
+
+        //! \brief The value of the remote free list of a cache whose thread has exited.
+        FreeBlock ClosedListSentinel;
+
+        inline UInt32 GetSizeClass(USize blockSize) noexcept
+        {
+            for (UInt32 i = 0; i < SizeClassCount; ++i)
+            {
+                if (blockSize <= BlockSizes[i])
+                {
+                    return i;
+                }
+            }
+
+            return LargeSizeClass;
+        }
+
+        class ThreadCache final
+        {
+            FreeBlock* m_FreeLists[SizeClassCount]  = {};
+            USize m_FreeBlockCounts[SizeClassCount] = {};
+
+            alignas(CacheLineSize) std::atomic<FreeBlock*> m_RemoteFreeList{ nullptr };
+
+            inline void PushLocal(FreeBlock* pBlock) noexcept
+            {
+                auto sizeClass = pBlock->Header.SizeClass;
+                if (m_FreeBlockCounts[sizeClass] >= MaxCachedBytes / BlockSizes[sizeClass])
+                {
+                    SystemAllocator::Get()->Deallocate(pBlock);
+                    return;
+                }
+
+                pBlock->pNext          = m_FreeLists[sizeClass];
+                m_FreeLists[sizeClass] = pBlock;
+                ++m_FreeBlockCounts[sizeClass];
+            }
+
+            inline static void DeallocateList(FreeBlock* pBlock) noexcept
+            {
+                while (pBlock)
+                {
+                    auto* pNext = pBlock->pNext;
+                    SystemAllocator::Get()->Deallocate(pBlock);
+                    pBlock = pNext;
+                }
+            }
+
+        public:
+            //! \brief Take a free block from the cache. Must be called from the owning thread.
+            //!
+            //! \return The block or nullptr if the cache has no free blocks of the size class.
+            inline BlockHeader* Allocate(UInt32 sizeClass) noexcept
+            {
+                if (m_FreeLists[sizeClass] == nullptr)
+                {
+                    // Take back all the blocks freed by other threads at once
+                    auto* pBlock = m_RemoteFreeList.exchange(nullptr, std::memory_order_acquire);
+                    while (pBlock)
+                    {
+                        auto* pNext = pBlock->pNext;
+                        PushLocal(pBlock);
+                        pBlock = pNext;
+                    }
+                }
+
+                auto* pBlock = m_FreeLists[sizeClass];
+                if (pBlock == nullptr)
+                {
+                    return nullptr;
+                }
+
+                m_FreeLists[sizeClass] = pBlock->pNext;
+                --m_FreeBlockCounts[sizeClass];
+                return &pBlock->Header;
+            }
+
+            //! \brief Return a block to the cache. Must be called from the owning thread.
+            inline void DeallocateLocal(BlockHeader* pHeader) noexcept
+            {
+                PushLocal(reinterpret_cast<FreeBlock*>(pHeader));
+            }
+
+            //! \brief Return a block to the cache from a thread that doesn't own it.
+            inline void DeallocateRemote(BlockHeader* pHeader) noexcept
+            {
+                auto* pBlock = reinterpret_cast<FreeBlock*>(pHeader);
+                auto* pHead  = m_RemoteFreeList.load(std::memory_order_relaxed);
+                do
+                {
+                    if (pHead == &ClosedListSentinel)
+                    {
+                        SystemAllocator::Get()->Deallocate(pBlock);
+                        return;
+                    }
+
+                    pBlock->pNext = pHead;
+                }
+                while (!m_RemoteFreeList.compare_exchange_weak(pHead, pBlock, std::memory_order_release,
+                                                               std::memory_order_relaxed));
+            }
+
+            //! \brief Release all the free blocks when the owning thread exits.
+            //!
+            //! Blocks freed after this call are returned directly to the system.
+            inline void Close() noexcept
+            {
+                for (UInt32 i = 0; i < SizeClassCount; ++i)
+                {
+                    DeallocateList(m_FreeLists[i]);
+                    m_FreeLists[i]       = nullptr;
+                    m_FreeBlockCounts[i] = 0;
+                }
+
+                DeallocateList(m_RemoteFreeList.exchange(&ClosedListSentinel, std::memory_order_acquire));
+            }
+
+            //! \brief Start using a closed cache on a new thread.
+            inline void Reopen() noexcept
+            {
+                m_RemoteFreeList.store(nullptr, std::memory_order_release);
+            }
+        };
+
+        //! \brief Global list of caches of exited threads. The caches are never freed, because blocks allocated
+        //! from them can outlive the threads, but they are reused by new threads.
+        class ThreadCacheRegistry final
+        {
+            SpinMutex m_Mutex;
+            List<ThreadCache*> m_ClosedCaches;
+
+        public:
+            inline static ThreadCacheRegistry& Get()
+            {
+                // Never destroyed: threads can exit after the static destructors, e.g. workers of a static scheduler
+                static auto* pRegistry = new (SystemAllocator::Get()->Allocate(sizeof(ThreadCacheRegistry),
+                                                                               alignof(ThreadCacheRegistry))) ThreadCacheRegistry;
+                return *pRegistry;
+            }
+
+            inline ThreadCache* Acquire()
+            {
+                {
+                    std::unique_lock lk(m_Mutex);
+                    if (m_ClosedCaches.Any())
+                    {
+                        auto* pCache = m_ClosedCaches.Pop();
+                        pCache->Reopen();
+                        return pCache;
+                    }
+                }
+
+                auto* allocator = SystemAllocator::Get();
+                return new (allocator->Allocate(sizeof(ThreadCache), alignof(ThreadCache))) ThreadCache;
+            }
+
+            inline void Release(ThreadCache* pCache)
+            {
+                pCache->Close();
+                std::unique_lock lk(m_Mutex);
+                m_ClosedCaches.Push(pCache);
+            }
+        };
+
+        thread_local ThreadCache* CurrentThreadCache = nullptr;
+        thread_local bool IsThreadExiting            = false;
+
+        struct ThreadCacheOwner final
+        {
+            inline ~ThreadCacheOwner()
+            {
+                IsThreadExiting = true;
+                if (CurrentThreadCache)
+                {
+                    ThreadCacheRegistry::Get().Release(CurrentThreadCache);
+                    CurrentThreadCache = nullptr;
+                }
+            }
+        };
+
+        //! \return Cache of the calling thread or nullptr if the thread is exiting.
+        inline ThreadCache* GetThreadCache()
+        {
+            if (CurrentThreadCache == nullptr && !IsThreadExiting)
+            {
+                static thread_local ThreadCacheOwner owner;
+                CurrentThreadCache = ThreadCacheRegistry::Get().Acquire();
+            }
+
+            return CurrentThreadCache;
+        }
+    } // namespace
+
+    void* SmallObjectAllocator::Allocate(USize size)
+    {
+        auto blockSize = size + sizeof(BlockHeader);
+        auto sizeClass = GetSizeClass(blockSize);
+
+        ThreadCache* pCache  = nullptr;
+        BlockHeader* pHeader = nullptr;
+        if (sizeClass != LargeSizeClass)
+        {
+            pCache = GetThreadCache();
+            if (pCache)
+            {
+                pHeader = pCache->Allocate(sizeClass);
+            }
+
+            blockSize = BlockSizes[sizeClass];
+        }
+
+        if (pHeader == nullptr)
+        {
+            auto* allocator    = SystemAllocator::Get();
+            pHeader            = static_cast<BlockHeader*>(allocator->Allocate(blockSize, alignof(BlockHeader)));
+            pHeader->pOwner    = pCache;
+            pHeader->SizeClass = sizeClass;
+        }
+
+        return pHeader + 1;
+    }
+
+    void SmallObjectAllocator::Deallocate(void* pointer) noexcept
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        auto* pHeader = static_cast<BlockHeader*>(pointer) - 1;
+        auto* pOwner  = pHeader->pOwner;
+        if (pOwner == nullptr)
+        {
+            SystemAllocator::Get()->Deallocate(pHeader);
+        }
+        else if (pOwner == CurrentThreadCache)
+        {
+            pOwner->DeallocateLocal(pHeader);
+        }
+        else
+        {
+            pOwner->DeallocateRemote(pHeader);
+        }
+    }
+} // namespace UN::Async::Internal
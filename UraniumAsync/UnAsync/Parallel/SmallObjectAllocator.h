@@ -0,0 +1,36 @@
+#pragma once
+#include <UnTL/Base/Base.h>
+
+namespace UN::Async::Internal
+{
+    //! \brief A thread-caching allocator for small short-lived objects like one-time jobs and coroutine frames.
+    //!
+    //! Blocks are grouped in size classes. Every thread keeps a free list per size class, so in steady state
+    //! neither allocation nor deallocation calls the system allocator or uses read-modify-write operations.
+    //! Each block remembers the cache of the thread that allocated it. A block freed on another thread is pushed
+    //! onto a lock-free list of the owning cache, and the owner takes the whole list back in one exchange when
+    //! its own free list of the required size class runs out.
+    //!
+    //! Allocations larger than MaxSize go straight to the system allocator.
+    class SmallObjectAllocator final
+    {
+    public:
+        //! \brief Maximum size of an allocation that is served from the thread caches.
+        inline static constexpr USize MaxSize = 1008;
+
+        //! \brief Alignment of all the returned blocks.
+        inline static constexpr USize Alignment = 16;
+
+        //! \brief Allocate a block of memory.
+        //!
+        //! \param size - Size of the block in bytes.
+        //!
+        //! \return The allocated block aligned to Alignment.
+        static void* Allocate(USize size);
+
+        //! \brief Deallocate a block of memory. Can be called from any thread.
+        //!
+        //! \param pointer - The block returned by Allocate().
+        static void Deallocate(void* pointer) noexcept;
+    };
+} // namespace UN::Async::Internal
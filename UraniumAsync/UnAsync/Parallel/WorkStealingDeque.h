@@ -0,0 +1,217 @@
+#pragma once
+#include <UnTL/Memory/Memory.h>
+#include <atomic>
+#include <type_traits>
+
+namespace UN::Async
+{
+    namespace Internal
+    {
+        //! \brief Size of a cache line used to pad data shared between threads.
+        inline constexpr USize CacheLineSize = 64;
+
+        template<class T>
+        class WorkStealingBuffer final
+        {
+            Int64 m_Mask;
+            WorkStealingBuffer* m_pRetired;
+            std::atomic<T>* m_pData;
+
+            inline explicit WorkStealingBuffer(Int64 capacity, WorkStealingBuffer* pRetired)
+                : m_Mask(capacity - 1)
+                , m_pRetired(pRetired)
+                , m_pData(reinterpret_cast<std::atomic<T>*>(this + 1))
+            {
+                for (Int64 i = 0; i < capacity; ++i)
+                {
+                    new (m_pData + i) std::atomic<T>(T{});
+                }
+            }
+
+        public:
+            //! \brief Allocate a buffer with specified capacity.
+            //!
+            //! \param capacity - Number of elements in the buffer, must be a power of two.
+            //! \param pRetired - Previous buffer that must be kept alive until the deque is destroyed.
+            inline static WorkStealingBuffer* Create(Int64 capacity, WorkStealingBuffer* pRetired)
+            {
+                UN_Assert((capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+
+                auto size    = sizeof(WorkStealingBuffer) + sizeof(std::atomic<T>) * capacity;
+                auto* memory = SystemAllocator::Get()->Allocate(size, alignof(WorkStealingBuffer));
+                return new (memory) WorkStealingBuffer(capacity, pRetired);
+            }
+
+            //! \brief Destroy this buffer and all the buffers it retired.
+            inline static void Destroy(WorkStealingBuffer* pBuffer)
+            {
+                while (pBuffer)
+                {
+                    auto* pRetired = pBuffer->m_pRetired;
+                    pBuffer->~WorkStealingBuffer();
+                    SystemAllocator::Get()->Deallocate(pBuffer);
+                    pBuffer = pRetired;
+                }
+            }
+
+            [[nodiscard]] inline Int64 Capacity() const noexcept
+            {
+                return m_Mask + 1;
+            }
+
+            [[nodiscard]] inline T Load(Int64 index) const noexcept
+            {
+                return m_pData[index & m_Mask].load(std::memory_order_relaxed);
+            }
+
+            inline void Store(Int64 index, T value) noexcept
+            {
+                m_pData[index & m_Mask].store(value, std::memory_order_relaxed);
+            }
+
+            //! \brief Create a buffer with twice the capacity and copy the elements in range [top, bottom) to it.
+            [[nodiscard]] inline WorkStealingBuffer* Grow(Int64 top, Int64 bottom)
+            {
+                auto* pResult = Create(Capacity() * 2, this);
+                for (Int64 i = top; i < bottom; ++i)
+                {
+                    pResult->Store(i, Load(i));
+                }
+
+                return pResult;
+            }
+        };
+    } // namespace Internal
+
+    //! \brief A lock-free work-stealing deque based on the Chase-Lev algorithm.
+    //!
+    //! The deque has a single owner thread that pushes and pops elements at the bottom (in LIFO order) and
+    //! any number of thieves that steal elements from the top (in FIFO order). The owner never executes
+    //! atomic read-modify-write operations, unless it competes with a thief for the last element. Every
+    //! steal costs exactly one CAS.
+    //!
+    //! The underlying ring buffer grows when full. Old buffers can still be read by thieves that started
+    //! a steal before the growth, so they are kept alive until the deque is destroyed. The total memory
+    //! of retired buffers never exceeds the memory of the current buffer.
+    //!
+    //! \tparam T - Type of elements, must be a pointer type.
+    template<class T>
+    class WorkStealingDeque final
+    {
+        static_assert(std::is_pointer_v<T>, "WorkStealingDeque can only store pointers");
+
+        using Buffer = Internal::WorkStealingBuffer<T>;
+
+        alignas(Internal::CacheLineSize) std::atomic<Int64> m_Top;
+        alignas(Internal::CacheLineSize) std::atomic<Int64> m_Bottom;
+        std::atomic<Buffer*> m_pBuffer;
+
+    public:
+        inline static constexpr Int64 DefaultCapacity = 256;
+
+        inline explicit WorkStealingDeque(Int64 initialCapacity = DefaultCapacity)
+            : m_Top(0)
+            , m_Bottom(0)
+            , m_pBuffer(Buffer::Create(initialCapacity, nullptr))
+        {
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&)            = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        inline ~WorkStealingDeque()
+        {
+            Buffer::Destroy(m_pBuffer.load(std::memory_order_relaxed));
+        }
+
+        //! \brief Push an element to the bottom of the deque. Must only be called by the owner thread.
+        //!
+        //! \param value - The element to push.
+        inline void Push(T value)
+        {
+            auto bottom   = m_Bottom.load(std::memory_order_relaxed);
+            auto top      = m_Top.load(std::memory_order_acquire);
+            auto* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+
+            if (bottom - top > pBuffer->Capacity() - 1)
+            {
+                pBuffer = pBuffer->Grow(top, bottom);
+                m_pBuffer.store(pBuffer, std::memory_order_release);
+            }
+
+            pBuffer->Store(bottom, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        //! \brief Pop an element from the bottom of the deque. Must only be called by the owner thread.
+        //!
+        //! \return The popped element or nullptr if the deque was empty.
+        inline T Pop()
+        {
+            auto bottom   = m_Bottom.load(std::memory_order_relaxed) - 1;
+            auto* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return T{};
+            }
+
+            T result = pBuffer->Load(bottom);
+            if (top == bottom)
+            {
+                // The last element, compete with thieves for it
+                if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    result = T{};
+                }
+
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return result;
+        }
+
+        //! \brief Steal an element from the top of the deque. Can be called from any thread.
+        //!
+        //! \return The stolen element or nullptr if the deque was empty or another thread won the race.
+        inline T Steal()
+        {
+            auto top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return T{};
+            }
+
+            auto* pBuffer = m_pBuffer.load(std::memory_order_acquire);
+            T result      = pBuffer->Load(top);
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return T{};
+            }
+
+            return result;
+        }
+
+        //! \return True if the deque was empty at the moment of the call.
+        [[nodiscard]] inline bool Empty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+        //! \return Approximate number of elements in the deque.
+        [[nodiscard]] inline USize Size() const noexcept
+        {
+            auto bottom = m_Bottom.load(std::memory_order_relaxed);
+            auto top    = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<USize>(bottom - top) : 0;
+        }
+    };
+} // namespace UN::Async
@@ -180,23 +180,8 @@ namespace UN::Async
         });
     }
 
-    Task<PipeFlushResult> Pipe::FlushAsync(const std::stop_token& cancellationToken)
+    PipeFlushResult Pipe::GetFlushResultUnsynchronized(const std::stop_token& cancellationToken) const
     {
-        if (cancellationToken.stop_requested())
-        {
-            co_return PipeFlushResult(PipeResultFlags::Cancelled);
-        }
-
-        m_Mutex.lock();
-        auto completeReader = CommitUnsynchronized();
-
-        if (!m_WriterAwaitable.IsSet())
-        {
-            m_Mutex.unlock();
-            co_await m_WriterAwaitable;
-            m_Mutex.lock();
-        }
-
         auto result = PipeResultFlags::None;
         if (m_ReaderComplete)
         {
@@ -207,14 +192,42 @@ namespace UN::Async
             result |= PipeResultFlags::Cancelled;
         }
 
+        return PipeFlushResult(result);
+    }
+
+    ValueTask<PipeFlushResult> Pipe::FlushAsync(const std::stop_token& cancellationToken)
+    {
+        if (cancellationToken.stop_requested())
+        {
+            return PipeFlushResult(PipeResultFlags::Cancelled);
+        }
+
+        m_Mutex.lock();
+        auto completeReader = CommitUnsynchronized();
+        auto isPaused       = !m_WriterAwaitable.IsSet();
+        auto result         = GetFlushResultUnsynchronized(cancellationToken);
         m_Mutex.unlock();
 
+        // Wake up the reader before waiting, only the reader can resume a paused writer
         if (completeReader)
         {
             Schedule(m_ReaderAwaitable);
         }
 
-        co_return PipeFlushResult(result);
+        if (isPaused)
+        {
+            return FlushAsyncSlow(cancellationToken);
+        }
+
+        return result;
+    }
+
+    Task<PipeFlushResult> Pipe::FlushAsyncSlow(std::stop_token cancellationToken)
+    {
+        co_await m_WriterAwaitable;
+
+        std::unique_lock lk(m_Mutex);
+        co_return GetFlushResultUnsynchronized(cancellationToken);
     }
 
     void Pipe::CompleteWriter()
@@ -379,40 +392,50 @@ namespace UN::Async
         }
     }
 
-    Task<PipeReadResult> Pipe::ReadAsync(const std::stop_token& cancellationToken)
+    PipeReadResult Pipe::GetReadResult(const std::stop_token& cancellationToken)
     {
-        UN_Assert(!m_ReaderComplete, "Reader completed");
+        std::unique_lock lk(m_Mutex);
+
+        auto flags = PipeResultFlags::None;
+        if (m_WriterComplete)
+        {
+            flags |= PipeResultFlags::Completed;
+        }
         if (cancellationToken.stop_requested())
         {
-            co_return PipeReadResult(PipeResultFlags::Cancelled, {});
+            flags |= PipeResultFlags::Cancelled;
         }
 
-        co_await m_ReaderAwaitable;
-
+        if (m_pReadingHead)
         {
-            std::unique_lock lk(m_Mutex);
+            auto begin    = SequencePosition<Byte>(m_pReadingHead, m_ReadingHeadIndex);
+            auto end      = SequencePosition<Byte>(m_pReadingTail, m_ReadingTailIndex);
+            auto sequence = ReadOnlySequence<Byte>(begin, end);
+            return PipeReadResult(flags, sequence);
+        }
 
-            auto flags = PipeResultFlags::None;
-            if (m_WriterComplete)
-            {
-                flags |= PipeResultFlags::Completed;
-            }
-            if (cancellationToken.stop_requested())
-            {
-                flags |= PipeResultFlags::Cancelled;
-            }
+        return PipeReadResult(flags, {});
+    }
 
-            if (m_pReadingHead)
-            {
-                auto begin    = SequencePosition<Byte>(m_pReadingHead, m_ReadingHeadIndex);
-                auto end      = SequencePosition<Byte>(m_pReadingTail, m_ReadingTailIndex);
-                auto sequence = ReadOnlySequence<Byte>(begin, end);
-                co_return PipeReadResult(flags, sequence);
-            }
-            else
-            {
-                co_return PipeReadResult(flags, {});
-            }
+    ValueTask<PipeReadResult> Pipe::ReadAsync(const std::stop_token& cancellationToken)
+    {
+        UN_Assert(!m_ReaderComplete, "Reader completed");
+        if (cancellationToken.stop_requested())
+        {
+            return PipeReadResult(PipeResultFlags::Cancelled, {});
+        }
+
+        if (m_ReaderAwaitable.IsSet())
+        {
+            return GetReadResult(cancellationToken);
         }
+
+        return ReadAsyncSlow(cancellationToken);
+    }
+
+    Task<PipeReadResult> Pipe::ReadAsyncSlow(std::stop_token cancellationToken)
+    {
+        co_await m_ReaderAwaitable;
+        co_return GetReadResult(cancellationToken);
     }
 } // namespace UN::Async
@@ -5,7 +5,7 @@
 #include <UnAsync/Parallel/SpinMutex.h>
 #include <UnAsync/Pipes/Internal/BufferSegment.h>
 #include <UnAsync/Pipes/PipeResults.h>
-#include <UnAsync/Task.h>
+#include <UnAsync/ValueTask.h>
 #include <UnTL/Base/Byte.h>
 #include <UnTL/Buffers/ArrayPool.h>
 #include <UnTL/Containers/ArraySlice.h>
@@ -82,6 +82,11 @@ namespace UN::Async
         inline void FreeSegment(BufferSegment* pSegment, bool allowPooling);
         inline void Schedule(AsyncEvent& event);
 
+        PipeFlushResult GetFlushResultUnsynchronized(const std::stop_token& cancellationToken) const;
+        PipeReadResult GetReadResult(const std::stop_token& cancellationToken);
+        Task<PipeFlushResult> FlushAsyncSlow(std::stop_token cancellationToken);
+        Task<PipeReadResult> ReadAsyncSlow(std::stop_token cancellationToken);
+
         void CompletePipe();
         void AllocateWritingHeadSync(USize sizeHint);
         void AllocateWritingHead(USize sizeHint);
@@ -114,7 +119,10 @@ namespace UN::Async
             AdvanceUnsynchronized(byteCount);
         }
 
-        Task<PipeFlushResult> FlushAsync(const std::stop_token& cancellationToken);
+        //! \brief Make the written data available to the reader.
+        //!
+        //! Completes synchronously unless the writer is paused, because the reader is too far behind.
+        ValueTask<PipeFlushResult> FlushAsync(const std::stop_token& cancellationToken);
 
         void CompleteWriter();
         void CompleteReader();
@@ -126,6 +134,9 @@ namespace UN::Async
 
         void AdvanceReader(const SequencePosition<Byte>& consumed, const SequencePosition<Byte>& examined);
 
-        Task<PipeReadResult> ReadAsync(const std::stop_token& cancellationToken);
+        //! \brief Read the data available in the pipe.
+        //!
+        //! Completes synchronously if the pipe already has unexamined data, otherwise waits for the writer.
+        ValueTask<PipeReadResult> ReadAsync(const std::stop_token& cancellationToken);
     };
 } // namespace UN::Async
@@ -1,4 +1,5 @@
 #pragma once
+#include <UnAsync/AsyncGenerator.h>
 #include <UnAsync/Pipes/Pipe.h>
 
 namespace UN::Async
@@ -13,7 +14,7 @@ namespace UN::Async
         {
         }
 
-        inline Task<PipeReadResult> ReadAsync(const std::stop_token& token) const
+        inline ValueTask<PipeReadResult> ReadAsync(const std::stop_token& token) const
         {
             return m_pPipe->ReadAsync(token);
         }
@@ -33,4 +34,30 @@ namespace UN::Async
             m_pPipe->CompleteReader();
         }
     };
+
+    //! \brief Read a pipe until the writer completes, yielding every contiguous buffer of the read sequences.
+    //!
+    //! A buffer points directly into the pipe's memory and stays valid until the consumer asks for the next one.
+    //! Everything is consumed once all the buffers of a read are yielded. The reader is not completed by the generator.
+    //!
+    //! \param reader            - The reader of the pipe.
+    //! \param cancellationToken - Stops the reading, the generator completes after the buffers of the current read.
+    inline AsyncGenerator<ArraySlice<const Byte>> ReadSegments(PipeReader reader, std::stop_token cancellationToken)
+    {
+        while (true)
+        {
+            auto read     = co_await reader.ReadAsync(cancellationToken);
+            auto sequence = read.GetMemory();
+            for (ArraySlice<const Byte> buffer : sequence)
+            {
+                co_yield buffer;
+            }
+
+            reader.Advance(sequence.EndPosition());
+            if (read.IsCompleted() || read.IsCancelled())
+            {
+                co_return;
+            }
+        }
+    }
 } // namespace UN::Async
@@ -23,7 +23,7 @@ namespace UN::Async
             m_pPipe->Advance(byteCount);
         }
 
-        inline Task<PipeFlushResult> FlushAsync(const std::stop_token& cancellationToken) const
+        inline ValueTask<PipeFlushResult> FlushAsync(const std::stop_token& cancellationToken) const
         {
             return m_pPipe->FlushAsync(cancellationToken);
         }
@@ -3,13 +3,47 @@
 
 namespace UN::Async
 {
+    //! \brief Block the calling thread until an awaitable completes.
+    //!
+    //! \param awaitable - The awaitable to wait for.
+    //! \param pScheduler - The job scheduler to execute jobs of while waiting, see IJobScheduler::HelpUntil(),
+    //!                     nullptr to block without doing anything.
+    //!
+    //! \return The result of the awaitable.
     template<typename TAwaitable>
-    inline auto SyncWait(TAwaitable&& awaitable) -> typename AwaitableTraits<TAwaitable&&>::AwaitResultType
+    inline auto SyncWait(TAwaitable&& awaitable, IJobScheduler* pScheduler) ->
+        typename AwaitableTraits<TAwaitable&&>::AwaitResultType
     {
         auto task = Internal::MakeSyncWaitTask(std::forward<TAwaitable>(awaitable));
         Internal::ManualResetEvent event;
-        task.Start(event);
-        event.Wait();
+        if (pScheduler)
+        {
+            // The thread that completes the task still uses the scheduler after setting the event
+            Internal::ManualResetEvent wokenEvent;
+            task.Start(event, pScheduler, &wokenEvent);
+            pScheduler->HelpUntil(event);
+            wokenEvent.Wait();
+        }
+        else
+        {
+            task.Start(event, nullptr, nullptr);
+            event.Wait();
+        }
+
         return task.GetResult();
     }
+
+    //! \brief Block the calling thread until an awaitable completes.
+    //!
+    //! A worker thread of a job scheduler keeps executing the scheduler's jobs instead of blocking, so that
+    //! the workers that wait for each other can't deadlock the scheduler.
+    //!
+    //! \param awaitable - The awaitable to wait for.
+    //!
+    //! \return The result of the awaitable.
+    template<typename TAwaitable>
+    inline auto SyncWait(TAwaitable&& awaitable) -> typename AwaitableTraits<TAwaitable&&>::AwaitResultType
+    {
+        return SyncWait(std::forward<TAwaitable>(awaitable), Internal::CurrentWorkerScheduler);
+    }
 } // namespace UN::Async
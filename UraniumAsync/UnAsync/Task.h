@@ -29,10 +29,13 @@ namespace UN::Async
                 return !m_Coroutine || m_Coroutine.done();
             }
 
-            inline bool await_suspend(std::coroutine_handle<> coroutine) noexcept
+            //! \brief Start the task by transferring execution to it, the task resumes the awaiting coroutine when done.
+            //!
+            //! Neither starting nor completing the task nests a resume() call, so long chains of awaits use constant stack.
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> coroutine) noexcept
             {
-                m_Coroutine.resume();
-                return m_Coroutine.promise().TrySetContinuation(coroutine);
+                m_Coroutine.promise().SetContinuation(coroutine);
+                return m_Coroutine;
             }
         };
 
@@ -0,0 +1,170 @@
+#pragma once
+#include <UnAsync/Task.h>
+#include <optional>
+
+namespace UN::Async
+{
+    //! \brief The result of an operation that often completes synchronously.
+    //!
+    //! A value task either holds a ready value inline or wraps a Task that produces the value later.
+    //! The operation returns the value directly on its fast path, so awaiting it needs neither a coroutine frame
+    //! nor a suspension. Unlike a Task, the operation starts when it's called, not when it's awaited.
+    //!
+    //! \tparam T - Type of the result.
+    template<class T = void>
+    class [[nodiscard]] ValueTask final
+    {
+        static_assert(!std::is_reference_v<T>, "ValueTask doesn't support references");
+
+        std::optional<T> m_Value;
+        Task<T> m_Task;
+
+        struct AwaiterBase
+        {
+            ValueTask* m_pTask;
+
+            [[nodiscard]] inline bool await_ready() const noexcept
+            {
+                return m_pTask->IsReady();
+            }
+
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> coroutine) noexcept
+            {
+                return m_pTask->m_Task.WhenReady().await_suspend(coroutine);
+            }
+        };
+
+    public:
+        using value_type = T;
+
+        //! \brief Create a completed value task.
+        inline ValueTask(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : m_Value(std::move(value))
+        {
+        }
+
+        //! \brief Create a value task that completes with a task.
+        inline ValueTask(Task<T>&& task) noexcept
+            : m_Task(std::move(task))
+        {
+        }
+
+        inline ValueTask(ValueTask&&) noexcept            = default;
+        inline ValueTask& operator=(ValueTask&&) noexcept = default;
+
+        inline ValueTask(const ValueTask&)            = delete;
+        inline ValueTask& operator=(const ValueTask&) = delete;
+
+        //! \return True if the value task holds its value inline, i.e. the operation completed synchronously.
+        [[nodiscard]] inline bool IsCompletedSynchronously() const noexcept
+        {
+            return m_Value.has_value();
+        }
+
+        [[nodiscard]] inline bool IsReady() const noexcept
+        {
+            return m_Value.has_value() || m_Task.IsReady();
+        }
+
+        inline auto operator co_await() & noexcept
+        {
+            struct Awaiter : AwaiterBase
+            {
+                inline T& await_resume()
+                {
+                    if (this->m_pTask->m_Value)
+                    {
+                        return *this->m_pTask->m_Value;
+                    }
+
+                    return this->m_pTask->m_Task.operator co_await().await_resume();
+                }
+            };
+
+            return Awaiter{ { this } };
+        }
+
+        inline auto operator co_await() && noexcept
+        {
+            struct Awaiter : AwaiterBase
+            {
+                inline T&& await_resume()
+                {
+                    if (this->m_pTask->m_Value)
+                    {
+                        return std::move(*this->m_pTask->m_Value);
+                    }
+
+                    return std::move(this->m_pTask->m_Task).operator co_await().await_resume();
+                }
+            };
+
+            return Awaiter{ { this } };
+        }
+    };
+
+    template<>
+    class [[nodiscard]] ValueTask<void> final
+    {
+        Task<void> m_Task;
+        bool m_HasTask = false;
+
+        struct Awaiter
+        {
+            ValueTask* m_pTask;
+
+            [[nodiscard]] inline bool await_ready() const noexcept
+            {
+                return m_pTask->IsReady();
+            }
+
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> coroutine) noexcept
+            {
+                return m_pTask->m_Task.WhenReady().await_suspend(coroutine);
+            }
+
+            inline void await_resume()
+            {
+                if (m_pTask->m_HasTask)
+                {
+                    m_pTask->m_Task.operator co_await().await_resume();
+                }
+            }
+        };
+
+    public:
+        using value_type = void;
+
+        //! \brief Create a completed value task.
+        inline ValueTask() noexcept = default;
+
+        //! \brief Create a value task that completes with a task.
+        inline ValueTask(Task<void>&& task) noexcept
+            : m_Task(std::move(task))
+            , m_HasTask(true)
+        {
+        }
+
+        inline ValueTask(ValueTask&&) noexcept            = default;
+        inline ValueTask& operator=(ValueTask&&) noexcept = default;
+
+        inline ValueTask(const ValueTask&)            = delete;
+        inline ValueTask& operator=(const ValueTask&) = delete;
+
+        //! \return True if the operation completed synchronously.
+        [[nodiscard]] inline bool IsCompletedSynchronously() const noexcept
+        {
+            return !m_HasTask;
+        }
+
+        [[nodiscard]] inline bool IsReady() const noexcept
+        {
+            return m_Task.IsReady();
+        }
+
+        inline auto operator co_await() noexcept
+        {
+            return Awaiter{ this };
+        }
+    };
+} // namespace UN::Async
@@ -3,6 +3,8 @@
 #include <UnAsync/Internal/WhenAllTask.h>
 #include <UnAsync/TaskMap.h>
 #include <UnAsync/Traits.h>
+#include <ranges>
+#include <vector>
 
 namespace UN::Async
 {
@@ -22,6 +24,75 @@ namespace UN::Async
 
         template<typename T>
         using UnwrapReference = typename UnwrapReferenceImpl<T>::type;
+
+        //! \brief Make a WhenAllTask from an element of a range.
+        //!
+        //! The elements of an lvalue range are awaited by reference, the range must outlive the await.
+        //! The elements of an rvalue range or a range of prvalues are moved into the task.
+        template<class TRange>
+        inline auto MakeRangeWhenAllTask(std::ranges::range_reference_t<TRange>&& element)
+        {
+            using TValue = std::ranges::range_value_t<TRange>;
+            using TRef   = std::ranges::range_reference_t<TRange>;
+            if constexpr (std::is_lvalue_reference_v<TRange> && std::is_lvalue_reference_v<TRef>
+                          && std::is_same_v<TValue, UnwrapReference<TValue>>)
+            {
+                return MakeWhenAllTask(std::ref(element));
+            }
+            else
+            {
+                return MakeWhenAllTask(static_cast<TValue&&>(element));
+            }
+        }
+
+        template<class TRange>
+        using RangeWhenAllTask = decltype(MakeRangeWhenAllTask<TRange>(std::declval<std::ranges::range_reference_t<TRange>>()));
+
+        template<class TRange>
+        inline auto MakeRangeWhenAllReady(TRange&& awaitables, IJobScheduler* pScheduler)
+        {
+            std::vector<RangeWhenAllTask<TRange>> tasks;
+            if constexpr (std::ranges::sized_range<TRange>)
+            {
+                tasks.reserve(std::ranges::size(awaitables));
+            }
+
+            for (auto&& awaitable : awaitables)
+            {
+                tasks.push_back(MakeRangeWhenAllTask<TRange>(static_cast<decltype(awaitable)>(awaitable)));
+            }
+
+            return WhenAllReadyAwaiter<std::vector<RangeWhenAllTask<TRange>>>(std::move(tasks), pScheduler);
+        }
+
+        //! \brief Gather the results of finished WhenAllTasks into a vector, rethrow the first exception if any.
+        template<class TTask>
+        inline auto GetRangeResults(std::vector<TTask>&& tasks)
+        {
+            using TResult = decltype(std::move(tasks.front()).GetResult());
+            if constexpr (std::is_void_v<TResult>)
+            {
+                for (auto& task : tasks)
+                {
+                    std::move(task).GetResult();
+                }
+            }
+            else
+            {
+                using TValue = std::conditional_t<std::is_lvalue_reference_v<TResult>,
+                                                  std::reference_wrapper<std::remove_reference_t<TResult>>,
+                                                  std::remove_cvref_t<TResult>>;
+
+                std::vector<TValue> results;
+                results.reserve(tasks.size());
+                for (auto& task : tasks)
+                {
+                    results.push_back(std::move(task).GetResult());
+                }
+
+                return results;
+            }
+        }
     } // namespace Internal
 
     // clang-format off
@@ -52,4 +123,75 @@ namespace UN::Async
             },
             WhenAllReady(std::forward<TAwaitables>(awaitables)...));
     }
+
+    //! \brief Await all the awaitables of a range.
+    //!
+    //! The tasks are started one by one on the awaiting thread. The result is a vector of tasks, which must be
+    //! used to get the results or the exceptions of the awaitables. The awaitables of an lvalue range are awaited by
+    //! reference, the range must outlive the await.
+    //!
+    //! \param awaitables - A range of awaitables, e.g. std::vector<Task<T>>.
+    // clang-format off
+    template<std::ranges::input_range TRange>
+    requires(Awaitable<Internal::UnwrapReference<std::ranges::range_value_t<TRange>>>)
+    [[nodiscard]] inline auto WhenAllReady(TRange&& awaitables)
+    // clang-format on
+    {
+        return Internal::MakeRangeWhenAllReady(std::forward<TRange>(awaitables), nullptr);
+    }
+
+    //! \brief Await all the awaitables of a range, starting them in parallel on the workers of a job scheduler.
+    //!
+    //! All the awaitables but the last one are submitted to the scheduler as jobs, the last one is started inline.
+    //! Useful when the awaitables do a significant amount of work before their first suspension.
+    //!
+    //! \param pScheduler - The job scheduler to start the awaitables on.
+    //! \param awaitables - A range of awaitables, e.g. std::vector<Task<T>>.
+    // clang-format off
+    template<std::ranges::input_range TRange>
+    requires(Awaitable<Internal::UnwrapReference<std::ranges::range_value_t<TRange>>>)
+    [[nodiscard]] inline auto WhenAllReady(IJobScheduler* pScheduler, TRange&& awaitables)
+    // clang-format on
+    {
+        return Internal::MakeRangeWhenAllReady(std::forward<TRange>(awaitables), pScheduler);
+    }
+
+    //! \brief Await all the awaitables of a range and gather their results.
+    //!
+    //! \param awaitables - A range of awaitables, e.g. std::vector<Task<T>>.
+    //!
+    //! \return A task that returns a std::vector of results in the order of the range, or void if the awaitables
+    //!         return void. The first exception thrown by an awaitable is rethrown after all of them finish.
+    // clang-format off
+    template<std::ranges::input_range TRange>
+    requires(Awaitable<Internal::UnwrapReference<std::ranges::range_value_t<TRange>>>)
+    [[nodiscard]] inline auto WhenAll(TRange&& awaitables)
+    // clang-format on
+    {
+        return MapTask(
+            [](auto&& tasks) {
+                return Internal::GetRangeResults(std::move(tasks));
+            },
+            WhenAllReady(std::forward<TRange>(awaitables)));
+    }
+
+    //! \brief Await all the awaitables of a range, starting them in parallel, and gather their results.
+    //!
+    //! \param pScheduler - The job scheduler to start the awaitables on.
+    //! \param awaitables - A range of awaitables, e.g. std::vector<Task<T>>.
+    //!
+    //! \return A task that returns a std::vector of results in the order of the range, or void if the awaitables
+    //!         return void. The first exception thrown by an awaitable is rethrown after all of them finish.
+    // clang-format off
+    template<std::ranges::input_range TRange>
+    requires(Awaitable<Internal::UnwrapReference<std::ranges::range_value_t<TRange>>>)
+    [[nodiscard]] inline auto WhenAll(IJobScheduler* pScheduler, TRange&& awaitables)
+    // clang-format on
+    {
+        return MapTask(
+            [](auto&& tasks) {
+                return Internal::GetRangeResults(std::move(tasks));
+            },
+            WhenAllReady(pScheduler, std::forward<TRange>(awaitables)));
+    }
 } // namespace UN::Async
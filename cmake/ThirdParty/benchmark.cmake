@@ -0,0 +1,16 @@
+mark_as_advanced(
+    BENCHMARK_ENABLE_TESTING BENCHMARK_ENABLE_GTEST_TESTS BENCHMARK_ENABLE_INSTALL
+    BENCHMARK_ENABLE_WERROR BENCHMARK_DOWNLOAD_DEPENDENCIES
+)
+
+CPMAddPackage(
+    NAME benchmark
+    GITHUB_REPOSITORY google/benchmark
+    GIT_TAG v1.8.3
+    VERSION 1.8.3
+    OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_GTEST_TESTS OFF" "BENCHMARK_ENABLE_INSTALL OFF"
+            "BENCHMARK_ENABLE_WERROR OFF"
+)
+
+set_target_properties(benchmark      PROPERTIES FOLDER "ThirdParty")
+set_target_properties(benchmark_main PROPERTIES FOLDER "ThirdParty")